@@ -147,10 +147,56 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	if (chunk) {
-		uint64_t size = chunk->meta_data.total_compressed_size;
-		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+	if (!chunk) {
+		return;
+	}
+	auto column_buffer_size = transport.GetColumnBufferSize();
+	if (!page_locations.empty()) {
+		// we know where the pages are - only register the dictionary and the pages that are actually read
+		auto file_offset = FileOffset();
+		auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+		idx_t read_size = first_page_offset - MinValue<idx_t>(file_offset, first_page_offset);
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			if (pages_to_read[page_idx]) {
+				read_size += NumericCast<idx_t>(page_locations[page_idx].compressed_page_size);
+			}
+		}
+		if (read_size <= column_buffer_size) {
+			if (first_page_offset > file_offset) {
+				transport.RegisterPrefetch(file_offset, first_page_offset - file_offset, allow_merge);
+			}
+			for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+				if (!pages_to_read[page_idx]) {
+					continue;
+				}
+				auto &page_location = page_locations[page_idx];
+				transport.RegisterPrefetch(NumericCast<idx_t>(page_location.offset),
+				                           NumericCast<uint64_t>(page_location.compressed_page_size), allow_merge);
+			}
+			return;
+		}
 	}
+	uint64_t size = chunk->meta_data.total_compressed_size;
+	if (size > column_buffer_size) {
+		// the column chunk does not fit in the buffer: stream through it, pages that are skipped are not read at all
+		transport.RegisterStreamedPrefetch(FileOffset(), size);
+		return;
+	}
+	transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+}
+
+void ColumnReader::GetColumnChunkIndexes(vector<idx_t> &result) const {
+	result.push_back(file_idx);
+}
+
+void ColumnReader::SetPageIndex(vector<PageLocation> page_locations_p, vector<bool> pages_to_read_p) {
+	D_ASSERT(page_locations_p.size() == pages_to_read_p.size());
+	if (HasRepeats() || page_locations_p.empty()) {
+		// we can only jump to page boundaries if every value is a row
+		return;
+	}
+	page_locations = std::move(page_locations_p);
+	pages_to_read = std::move(pages_to_read_p);
 }
 
 uint64_t ColumnReader::TotalCompressedSize() {
@@ -220,6 +266,11 @@ void ColumnReader::DictReference(Vector &result) {
 void ColumnReader::PlainReference(shared_ptr<ByteBuffer>, Vector &result) { // NOLINT
 }
 
+bool ColumnReader::EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, // NOLINT
+                                        Vector &result) {
+	return false;
+}
+
 void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) {
 	D_ASSERT(file_idx < columns.size());
 	chunk = &columns[file_idx];
@@ -238,6 +289,11 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// any state left over from the previous column chunk is no longer relevant
+	page_rows_available = 0;
+	pending_skips = 0;
+	page_locations.clear();
+	pages_to_read.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -245,6 +301,8 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 	defined_decoder.reset();
 	bss_decoder.reset();
 	block.reset();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto page_offset = trans.GetLocation();
 	PageHeader page_hdr;
 	reader.Read(page_hdr, *protocol);
 
@@ -259,6 +317,7 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 		break;
 	case PageType::DICTIONARY_PAGE:
 		PreparePage(page_hdr);
+		dictionary_id = reader.file_name + ":" + std::to_string(page_offset);
 		Dictionary(std::move(block), page_hdr.dictionary_page_header.num_values);
 		break;
 	default:
@@ -270,6 +329,73 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 void ColumnReader::ResetPage() {
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	D_ASSERT(page_rows_available == 0 && !HasRepeats());
+	if (reader.parquet_options.encryption_config) {
+		// encrypted pages are not stored at the sizes that are listed in the page headers
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	idx_t skipped = 0;
+	if (!page_locations.empty()) {
+		// the dictionary precedes the data pages and is always read
+		while (page_rows_available == 0 && chunk_read_offset < NumericCast<idx_t>(page_locations[0].offset)) {
+			trans.SetLocation(chunk_read_offset);
+			PrepareRead(none_filter);
+			chunk_read_offset = trans.GetLocation();
+		}
+		if (page_rows_available > 0) {
+			return 0;
+		}
+		// use the OffsetIndex to jump directly to the page that contains the first row we need to read
+		auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+		auto target_row = current_row + num_values;
+		auto entry = std::upper_bound(page_locations.begin(), page_locations.end(), target_row,
+		                              [](idx_t row, const PageLocation &location) {
+			                              return row < NumericCast<idx_t>(location.first_row_index);
+		                              });
+		if (entry == page_locations.begin()) {
+			return 0;
+		}
+		--entry;
+		auto first_row_index = NumericCast<idx_t>(entry->first_row_index);
+		if (first_row_index <= current_row) {
+			return 0;
+		}
+		skipped = first_row_index - current_row;
+		chunk_read_offset = NumericCast<idx_t>(entry->offset);
+	} else {
+		// no OffsetIndex: read the page headers to figure out how many values each page contains
+		while (skipped < num_values) {
+			trans.SetLocation(chunk_read_offset);
+			PageHeader page_hdr;
+			reader.Read(page_hdr, *protocol);
+			idx_t page_values;
+			if (page_hdr.type == PageType::DATA_PAGE) {
+				page_values = NumericCast<idx_t>(page_hdr.data_page_header.num_values);
+			} else if (page_hdr.type == PageType::DATA_PAGE_V2) {
+				page_values = NumericCast<idx_t>(page_hdr.data_page_header_v2.num_values);
+			} else if (page_hdr.type == PageType::DICTIONARY_PAGE) {
+				trans.SetLocation(chunk_read_offset);
+				PrepareRead(none_filter);
+				chunk_read_offset = trans.GetLocation();
+				continue;
+			} else {
+				page_values = 0;
+			}
+			if (skipped + page_values > num_values) {
+				// this page has to be (partially) read
+				break;
+			}
+			chunk_read_offset = trans.GetLocation() + NumericCast<idx_t>(page_hdr.compressed_page_size);
+			skipped += page_values;
+		}
+	}
+	trans.SetLocation(chunk_read_offset);
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 void ColumnReader::PreparePageV2(PageHeader &page_hdr) {
 	D_ASSERT(page_hdr.type == PageType::DATA_PAGE_V2);
 
@@ -482,6 +608,31 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 	}
 }
 
+//! Whether any of the rows in [offset, offset + count) pass the filter
+static bool FilterRangeHasRows(const parquet_filter_t &filter, idx_t offset, idx_t count) {
+	if (offset == 0 && count == STANDARD_VECTOR_SIZE) {
+		return filter.any();
+	}
+	for (idx_t row_idx = offset; row_idx < offset + count; row_idx++) {
+		if (filter.test(row_idx)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! The number of rows in [begin, end) that are not NULL, i.e. that have a dictionary offset or value in the page
+static idx_t DefinedValueCount(const_data_ptr_t defines, bool has_defines, idx_t max_define, idx_t begin, idx_t end) {
+	if (!has_defines) {
+		return end - begin;
+	}
+	idx_t count = 0;
+	for (idx_t row_idx = begin; row_idx < end; row_idx++) {
+		count += defines[row_idx] == max_define;
+	}
+	return count;
+}
+
 idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
                          Vector &result) {
 	// we need to reset the location because multiple column readers share the same protocol
@@ -493,6 +644,12 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		ApplyPendingSkips(pending_skips);
 	}
 
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		// the result still holds a dictionary vector that was emitted by a previous read
+		Vector flat_result(result.GetType());
+		result.Reference(flat_result);
+	}
+
 	idx_t result_offset = 0;
 	auto to_read = num_values;
 
@@ -528,11 +685,38 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		}
 
 		if (dict_decoder) {
-			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
-			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			if (!FilterRangeHasRows(filter, result_offset, read_now)) {
+				// none of these rows are needed (e.g. all rows were rejected by a filter on another column)
+				// skip over the dictionary offsets without unpacking or looking them up
+				dict_decoder->Skip(UnsafeNumericCast<uint32_t>(read_now - null_count));
+			} else {
+				// only unpack the offsets from the first up to the last row that passes the filter
+				auto begin = result_offset;
+				while (!filter.test(begin)) {
+					begin++;
+				}
+				auto end = result_offset + read_now;
+				while (!filter.test(end - 1)) {
+					end--;
+				}
+				auto skip_before = DefinedValueCount(define_out, HasDefines(), max_define, result_offset, begin);
+				auto read_count = DefinedValueCount(define_out, HasDefines(), max_define, begin, end);
+				auto skip_after = read_now - null_count - skip_before - read_count;
+
+				offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
+				dict_decoder->Skip(UnsafeNumericCast<uint32_t>(skip_before));
+				dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr + sizeof(uint32_t) * skip_before,
+				                                 UnsafeNumericCast<uint32_t>(read_count));
+				dict_decoder->Skip(UnsafeNumericCast<uint32_t>(skip_after));
+				auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+				// if the entire vector comes from this dictionary we can emit it without copying the values
+				bool entire_vector = emit_dictionary_vectors && !HasRepeats() && result_offset == 0 &&
+				                     read_now == num_values && read_count == read_now - null_count;
+				if (!entire_vector || !EmitDictionaryVector(offsets, define_out, read_now, result)) {
+					DictReference(result);
+					Offsets(offsets, define_out, read_now, filter, result_offset, result);
+				}
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
@@ -606,14 +790,27 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	dummy_define.zero();
 	dummy_repeat.zero();
 
-	// TODO this can be optimized, for example we dont actually have to bitunpack offsets
+	// the none_filter lets Read() skip over dictionary offsets and values without decoding them
 	Vector dummy_result(type, nullptr);
 
 	idx_t remaining = num_values;
 	idx_t read = 0;
 
 	while (remaining) {
+		if (page_rows_available == 0 && !HasRepeats()) {
+			// we are at a page boundary: pages that are skipped entirely do not need to be decompressed or decoded
+			auto skipped = SkipPages(remaining);
+			read += skipped;
+			remaining -= skipped;
+			if (!remaining) {
+				break;
+			}
+		}
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
+		if (page_rows_available > 0) {
+			// only decode up to the end of the current page, so we can skip over the next pages
+			to_read = MinValue<idx_t>(to_read, page_rows_available);
+		}
 		read += Read(to_read, none_filter, dummy_define.ptr, dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
 	}
@@ -659,7 +856,9 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
-	dict_strings = unsafe_unique_ptr<string_t[]>(new string_t[num_entries]);
+	dict_size = num_entries;
+	dict_strings = make_uniq<Vector>(Type(), num_entries + 1);
+	auto dict_data = FlatVector::GetData<string_t>(*dict_strings);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
 		if (fixed_width_string_length == 0) {
@@ -673,9 +872,11 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 
 		auto dict_str = reinterpret_cast<const char *>(dict->ptr);
 		auto actual_str_len = VerifyString(dict_str, str_len);
-		dict_strings[dict_idx] = string_t(dict_str, actual_str_len);
+		dict_data[dict_idx] = string_t(dict_str, actual_str_len);
 		dict->inc(str_len);
 	}
+	FlatVector::SetNull(*dict_strings, num_entries, true);
+	DictReference(*dict_strings);
 }
 
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
@@ -790,8 +991,35 @@ void StringColumnReader::PlainReference(shared_ptr<ByteBuffer> plain_data, Vecto
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(std::move(plain_data)));
 }
 
+bool StringColumnReader::EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values,
+                                              Vector &result) {
+	if (!dict_strings) {
+		throw IOException(
+		    "Parquet file is likely corrupted, cannot have dictionary offsets without seeing a dictionary first.");
+	}
+	// null rows point to the NULL entry at the end of the dictionary
+	SelectionVector sel(num_values);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			sel.set_index(row_idx, dict_size);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= dict_size) {
+			throw IOException("Parquet file is likely corrupted, dictionary offset %llu is out of range for a "
+			                  "dictionary with %llu entries.",
+			                  offset, dict_size);
+		}
+		sel.set_index(row_idx, offset);
+	}
+	result.Dictionary(*dict_strings, dict_size + 1, sel, num_values);
+	DictionaryVector::SetDictionaryId(result, dictionary_id);
+	return true;
+}
+
 string_t StringParquetValueConversion::DictRead(ByteBuffer &dict, uint32_t &offset, ColumnReader &reader) {
-	return reader.Cast<StringColumnReader>().dict_strings[offset];
+	return FlatVector::GetData<string_t>(*reader.Cast<StringColumnReader>().dict_strings)[offset];
 }
 
 string_t StringParquetValueConversion::PlainRead(ByteBuffer &plain_data, ColumnReader &reader) {
@@ -945,8 +1173,9 @@ ListColumnReader::ListColumnReader(ParquetReader &reader, LogicalType type_p, co
 void ListColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
-	auto define_out = unique_ptr<uint8_t[]>(new uint8_t[num_values]);
-	auto repeat_out = unique_ptr<uint8_t[]>(new uint8_t[num_values]);
+	// every read is at most a vector - the skipped rows are never materialized at once
+	auto define_out = unique_ptr<uint8_t[]>(new uint8_t[STANDARD_VECTOR_SIZE]);
+	auto repeat_out = unique_ptr<uint8_t[]>(new uint8_t[STANDARD_VECTOR_SIZE]);
 
 	idx_t remaining = num_values;
 	idx_t read = 0;
@@ -1209,6 +1438,12 @@ void StructColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool a
 	}
 }
 
+void StructColumnReader::GetColumnChunkIndexes(vector<idx_t> &result) const {
+	for (auto &child : child_readers) {
+		child->GetColumnChunkIndexes(result);
+	}
+}
+
 uint64_t StructColumnReader::TotalCompressedSize() {
 	uint64_t size = 0;
 	for (auto &child : child_readers) {
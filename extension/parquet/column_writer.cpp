@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -88,6 +89,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -334,6 +338,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of the page, which are merged into the statistics of the column chunk when the page is flushed
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -356,6 +362,13 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+
+	//! Whether or not a Bloom filter is written for this column chunk
+	bool write_bloom_filter = false;
+	//! The (distinct) hashes of the values that are inserted into the Bloom filter
+	unordered_set<uint64_t> bloom_filter_hashes;
+	//! The Bloom filter that is built from the hashes in EndWrite
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -374,6 +387,9 @@ public:
 	//! We limit the uncompressed page size to 100MB
 	//! The max size in Parquet is 2GB, but we choose a more conservative limit
 	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! The maximum number of values in a page. This keeps the pages of narrow columns small enough for the page index
+	//! to be selective.
+	static constexpr const idx_t MAX_PAGE_VALUE_COUNT = 20000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -391,6 +407,7 @@ public:
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void EndWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -425,8 +442,18 @@ protected:
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
+	//! Hashes the (non-null) values of a (subset of a) vector for the Bloom filter. Only used for scalar types.
+	//! Types that do not override this method do not get a Bloom filter.
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+	                               idx_t chunk_end) {
+	}
+	void WriteBloomFilter(ParquetBloomFilter &bloom_filter, duckdb_parquet::format::ColumnChunk &column_chunk);
+
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+	//! Builds the ColumnIndex and OffsetIndex of the column chunk from the pages that were written
+	void RegisterPageIndex(BasicColumnWriterState &state,
+	                       vector<duckdb_parquet::format::PageLocation> page_locations);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -465,19 +492,31 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 
 	idx_t vector_index = 0;
 	reference<PageInformation> page_info_ref = state.page_info.back();
+	auto page_size = writer.PageSizeBytes();
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = page_info_ref.get();
-		page_info.row_count++;
+		if (page_info.row_count > 0 &&
+		    (page_info.estimated_page_size >= page_size || page_info.row_count >= MAX_PAGE_VALUE_COUNT) &&
+		    (state.repetition_levels.empty() || state.repetition_levels[parent_index + i] == 0)) {
+			// the page reached its target size - start a new page at the next row boundary
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
+			page_info_ref = state.page_info.back();
+		}
+		auto &current_info = page_info_ref.get();
+		current_info.row_count++;
 		col_chunk.meta_data.num_values++;
 		if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
-			page_info.empty_count++;
+			current_info.empty_count++;
 			continue;
 		}
 		if (validity.RowIsValid(vector_index)) {
-			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			current_info.estimated_page_size += GetRowSize(vector, vector_index, state);
+			if (current_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+				// hard limit: the page is split even if this is not a row boundary
 				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
+				new_info.offset = current_info.offset + current_info.row_count;
 				state.page_info.push_back(new_info);
 				page_info_ref = state.page_info.back();
 			}
@@ -495,6 +534,7 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	state.write_bloom_filter = max_repeat == 0 && writer.HasBloomFilter(schema_path);
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -520,6 +560,7 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		write_info.page_stats = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -590,6 +631,7 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	state.stats_state->Merge(*write_info.page_stats);
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -634,8 +676,11 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.page_stats.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (state.write_bloom_filter) {
+			UpdateBloomFilter(state, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -681,27 +726,50 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.__isset.statistics = true;
 	}
+	auto &encodings = column_chunk.meta_data.encodings;
 	for (const auto &write_info : state.write_info) {
-		column_chunk.meta_data.encodings.push_back(write_info.page_header.data_page_header.encoding);
+		auto encoding = write_info.page_header.data_page_header.encoding;
+		if (std::find(encodings.begin(), encodings.end(), encoding) == encodings.end()) {
+			encodings.push_back(encoding);
+		}
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::EndWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
-	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
+	// compress the dictionary page, which is inserted as the first page
+	if (HasDictionary(state)) {
+		FlushDictionary(state, state.stats_state.get());
+	}
+
+	// size the Bloom filter based on the number of distinct values in this column chunk
+	if (!state.bloom_filter_hashes.empty()) {
+		auto num_bytes = ParquetBloomFilter::OptimalNumOfBytes(state.bloom_filter_hashes.size(),
+		                                                       writer.BloomFilterFalsePositiveRatio());
+		state.bloom_filter = make_uniq<ParquetBloomFilter>(num_bytes);
+		for (auto &hash : state.bloom_filter_hashes) {
+			state.bloom_filter->Insert(hash);
+		}
+		state.bloom_filter_hashes.clear();
+	}
+}
+
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	auto &column_chunk = state.row_group.columns[state.col_idx];
+
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
-	// flush the dictionary
+	// the dictionary page (if any) is the first page that is written
 	if (HasDictionary(state)) {
 		column_chunk.meta_data.statistics.distinct_count = UnsafeNumericCast<int64_t>(DictionarySize(state));
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
-		column_chunk.meta_data.dictionary_page_offset = UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten());
+		column_chunk.meta_data.dictionary_page_offset = UnsafeNumericCast<int64_t>(start_offset);
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 	}
 
 	// record the start position of the pages for this column
@@ -710,6 +778,7 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<duckdb_parquet::format::PageLocation> page_locations;
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -724,10 +793,99 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = UnsafeNumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    UnsafeNumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	// the Bloom filter is written after the pages of the column chunk
+	if (state.bloom_filter) {
+		WriteBloomFilter(*state.bloom_filter, column_chunk);
+		state.bloom_filter.reset();
+	}
+	if (writer.HasPageIndex()) {
+		RegisterPageIndex(state, std::move(page_locations));
+	}
+}
+
+void BasicColumnWriter::RegisterPageIndex(BasicColumnWriterState &state,
+                                          vector<duckdb_parquet::format::PageLocation> page_locations) {
+	D_ASSERT(page_locations.size() == state.page_info.size());
+	// the dictionary page (if any) precedes the data pages
+	auto first_data_page = state.write_info.size() - state.page_info.size();
+
+	auto offset_index = make_uniq<duckdb_parquet::format::OffsetIndex>();
+	auto column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+	column_index->boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	idx_t row_index = 0;
+	idx_t level_index = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto &page_info = state.page_info[page_idx];
+		auto &page_location = page_locations[page_idx];
+		// figure out the first row of the page
+		if (state.repetition_levels.empty()) {
+			row_index = page_info.offset;
+		} else {
+			if (state.repetition_levels[page_info.offset] != 0) {
+				// the page does not start at a row boundary - this only happens for pages that exceed the hard limit
+				return;
+			}
+			for (; level_index < page_info.offset; level_index++) {
+				if (state.repetition_levels[level_index] == 0) {
+					row_index++;
+				}
+			}
+		}
+		page_location.first_row_index = UnsafeNumericCast<int64_t>(row_index);
+
+		idx_t null_count = 0;
+		if (!state.definition_levels.empty()) {
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				if (state.definition_levels[i] != max_define) {
+					null_count++;
+				}
+			}
+		}
+		auto &page_stats = *state.write_info[first_data_page + page_idx].page_stats;
+		bool null_page = null_count == page_info.row_count;
+		if (!null_page && !page_stats.HasStats()) {
+			// we have no statistics for this page - we can only write the OffsetIndex
+			column_index.reset();
+		}
+		if (column_index) {
+			column_index->null_pages.push_back(null_page);
+			column_index->min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+			column_index->max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+			column_index->null_counts.push_back(UnsafeNumericCast<int64_t>(null_count));
+		}
+	}
+	offset_index->page_locations = std::move(page_locations);
+	writer.AddPageIndex(state.col_idx, std::move(column_index), std::move(offset_index));
+}
+
+void BasicColumnWriter::WriteBloomFilter(ParquetBloomFilter &bloom_filter,
+                                         duckdb_parquet::format::ColumnChunk &column_chunk) {
+	duckdb_parquet::format::BloomFilterHeader header;
+	header.numBytes = NumericCast<int32_t>(bloom_filter.Size());
+	header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+	header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+	header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+	auto &column_writer = writer.GetWriter();
+	auto bloom_filter_offset = column_writer.GetTotalWritten();
+	writer.Write(header);
+	writer.WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.Size()));
+	column_chunk.meta_data.__set_bloom_filter_offset(UnsafeNumericCast<int64_t>(bloom_filter_offset));
+	column_chunk.meta_data.__set_bloom_filter_length(
+	    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -797,6 +955,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -920,6 +1087,19 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			state.bloom_filter_hashes.insert(ParquetBloomFilter::Hash<TGT>(target_value));
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
@@ -953,6 +1133,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1084,6 +1269,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1307,6 +1499,18 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+		} else if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1445,11 +1649,17 @@ public:
 		auto *ptr = FlatVector::GetData<string_t>(input_column);
 		if (page_state.IsDictionaryEncoded()) {
 			// dictionary based page
+			uint32_t last_value_index = NumericLimits<uint32_t>::Maximum();
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
 				if (!mask.RowIsValid(r)) {
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (value_index != last_value_index) {
+					// only update the page statistics once per run of the same value
+					stats.Update(ptr[r]);
+					last_value_index = value_index;
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1474,6 +1684,19 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			state.bloom_filter_hashes.insert(
+			    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
@@ -1707,6 +1930,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void EndWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1796,6 +2020,13 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
+void StructColumnWriter::EndWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
+		child_writers[child_idx]->EndWrite(*state.child_states[child_idx]);
+	}
+}
+
 void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
@@ -1828,6 +2059,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void EndWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1970,6 +2202,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::EndWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->EndWrite(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
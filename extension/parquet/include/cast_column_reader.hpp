@@ -45,6 +45,14 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void GetColumnChunkIndexes(vector<idx_t> &result) const override {
+		child_reader->GetColumnChunkIndexes(result);
+	}
+
+	void SetPageIndex(vector<PageLocation> page_locations, vector<bool> pages_to_read) override {
+		child_reader->SetPageIndex(std::move(page_locations), std::move(pages_to_read));
+	}
 };
 
 } // namespace duckdb
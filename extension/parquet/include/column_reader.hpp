@@ -33,6 +33,7 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
@@ -67,9 +68,19 @@ public:
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
+	// add the indexes of the column chunks this reader reads from, used to read ahead the next row groups
+	virtual void GetColumnChunkIndexes(vector<idx_t> &result) const;
+	// set the page locations of the current column chunk (from the OffsetIndex), which are used to skip over entire
+	// pages and to only prefetch the pages that are marked in "pages_to_read"
+	virtual void SetPageIndex(vector<PageLocation> page_locations, vector<bool> pages_to_read);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
+	// allow this reader to emit dictionary vectors - only used for top-level columns
+	void SetEmitDictionaryVectors(bool emit) {
+		emit_dictionary_vectors = emit;
+	}
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
@@ -126,6 +137,8 @@ protected:
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
+	// emits the dictionary offsets of an entire vector as a dictionary vector, returns false if not supported
+	virtual bool EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result);
 
 	virtual void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer);
 	virtual void PrepareDeltaByteArray(ResizeableBuffer &buffer);
@@ -157,12 +170,18 @@ protected:
 
 	idx_t pending_skips = 0;
 
+	// whether entire vectors of dictionary offsets may be emitted as dictionary vectors
+	bool emit_dictionary_vectors = false;
+	// identifies the current dictionary within the scan: the file name and the offset of the dictionary page
+	string dictionary_id;
+
 	virtual void ResetPage();
 
 private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	idx_t SkipPages(idx_t num_values);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
@@ -175,6 +194,9 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	// the page locations of the current column chunk - empty if the chunk has no OffsetIndex
+	vector<PageLocation> page_locations;
+	vector<bool> pages_to_read;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Combines the statistics of another state of the same type into this state
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -105,6 +107,10 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Called after all data has been passed to Write - encodes and compresses the remaining pages, but does not write
+	//! anything to the file yet. This can be called for different row groups in parallel.
+	virtual void EndWrite(ColumnWriterState &state) = 0;
+	//! Writes the (compressed) pages to the file
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
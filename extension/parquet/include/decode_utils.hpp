@@ -1,6 +1,9 @@
 #pragma once
 
 #include "resizable_buffer.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/bitpacking.hpp"
+#endif
 
 namespace duckdb {
 class ParquetDecodeUtils {
@@ -22,9 +25,19 @@ public:
 			                            "the file might be corrupted.",
 			                            width, ParquetDecodeUtils::BITPACK_MASKS_SIZE);
 		}
+		uint32_t unpacked = 0;
+		if (bitpack_pos == BITPACK_DLEN) {
+			// the current byte is fully consumed
+			buffer.inc(1);
+			bitpack_pos = 0;
+		}
+		if (bitpack_pos == 0 && width <= sizeof(T) * 8) {
+			// at a byte boundary - unpack full groups with the unrolled kernels that the compiler vectorizes
+			unpacked = BitUnpackGroups<T>(buffer, dest, count, width);
+		}
 		auto mask = BITPACK_MASKS[width];
 
-		for (uint32_t i = 0; i < count; i++) {
+		for (uint32_t i = unpacked; i < count; i++) {
 			T val = (buffer.get<uint8_t>() >> bitpack_pos) & mask;
 			bitpack_pos += width;
 			while (bitpack_pos > BITPACK_DLEN) {
@@ -37,6 +50,31 @@ public:
 		return count;
 	}
 
+	//! Unpacks as many groups of BITPACKING_ALGORITHM_GROUP_SIZE values as possible, the buffer has to be at a byte
+	//! boundary. Parquet packs values starting at the least significant bit, which matches BitpackingPrimitives.
+	template <typename T>
+	static uint32_t BitUnpackGroups(ByteBuffer &buffer, T *dest, uint32_t count, uint8_t width) {
+		static constexpr idx_t GROUP_SIZE = BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		const auto group_count = count / GROUP_SIZE;
+		if (group_count == 0) {
+			return 0;
+		}
+		const idx_t group_bytes = width * GROUP_SIZE / 8;
+		buffer.available(group_count * group_bytes);
+		// the kernels read 32-bit words, copy the group if the page data is not aligned for that
+		uint32_t aligned_group[sizeof(T) * 8];
+		for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+			auto src = buffer.ptr;
+			if (reinterpret_cast<uintptr_t>(src) % sizeof(uint32_t) != 0) {
+				memcpy(aligned_group, src, group_bytes);
+				src = data_ptr_cast(aligned_group);
+			}
+			BitpackingPrimitives::UnPackBlock<T>(data_ptr_cast(dest + group_idx * GROUP_SIZE), src, width, true);
+			buffer.unsafe_inc(group_bytes);
+		}
+		return UnsafeNumericCast<uint32_t>(group_count * GROUP_SIZE);
+	}
+
 	template <class T>
 	static T VarintDecode(ByteBuffer &buf) {
 		T result = 0;
@@ -42,6 +42,10 @@ public:
 		child_column_reader->RegisterPrefetch(transport, allow_merge);
 	}
 
+	void GetColumnChunkIndexes(vector<idx_t> &result) const override {
+		child_column_reader->GetColumnChunkIndexes(result);
+	}
+
 private:
 	unique_ptr<ColumnReader> child_column_reader;
 	ResizeableBuffer child_defines;
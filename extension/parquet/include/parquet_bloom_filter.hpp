@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "parquet_types.h"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#endif
+
+namespace duckdb {
+
+//! A split block Bloom filter (SBBF) as specified by the Parquet format
+//! The filter consists of 32-byte blocks of eight 32-bit words. Each inserted hash sets one bit in every word of the
+//! block selected by the upper 32 bits of the hash.
+class ParquetBloomFilter {
+public:
+	//! Creates an empty filter of the given size in bytes (must be a power of two and at least one block)
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+	static constexpr const idx_t BYTES_PER_BLOCK = 32;
+	//! Upper bound on the size of the filter of a single column chunk
+	static constexpr const idx_t MAX_BLOOM_FILTER_BYTES = 128 * 1024 * 1024;
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	//! Returns the optimal size in bytes of a filter with the given number of distinct values and false positive ratio
+	static idx_t OptimalNumOfBytes(idx_t num_distinct_values, double false_positive_ratio);
+	//! Hashes the plain-encoded representation of a value (XXH64 with seed 0)
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+	//! Hashes a constant so it can be looked up in a Bloom filter of a column with the given physical type
+	//! Returns false if the constant cannot be mapped unambiguously onto its plain-encoded representation
+	static bool TryHashConstant(const Value &constant, duckdb_parquet::format::Type::type physical_type,
+	                            uint64_t &result);
+
+	void Insert(uint64_t hash);
+	bool FindHash(uint64_t hash) const;
+
+	data_ptr_t Data() {
+		return data_ptr_cast(blocks.data());
+	}
+	idx_t Size() const {
+		return blocks.size() * sizeof(uint32_t);
+	}
+
+private:
+	idx_t BlockIndex(uint64_t hash) const;
+
+private:
+	unsafe_vector<uint32_t> blocks;
+};
+
+} // namespace duckdb
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_io_planner.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
+#endif
+
+namespace duckdb {
+class FileHandle;
+class TaskScheduler;
+
+//! Estimates the cost of reading from a (remote) file: every request pays a fixed latency (e.g. the time to first
+//! byte of a ranged GET), after which the data arrives at a fixed bandwidth. The estimates are fitted to the requests
+//! that were issued, so the planner adapts to the store that is actually read from.
+class ParquetIOCostModel {
+public:
+	//! The estimates that are used until enough requests were observed - typical for an object store
+	static constexpr double DEFAULT_LATENCY = 0.03;
+	static constexpr double DEFAULT_BANDWIDTH = 100.0 * 1024.0 * 1024.0;
+	//! The number of requests that need to be observed before the fitted estimates are used
+	static constexpr idx_t MINIMUM_SAMPLES = 8;
+	//! Older requests are weighted down by this factor for every new request
+	static constexpr double SAMPLE_DECAY = 0.95;
+
+	//! Bounds of the gap between two ranges that is read over rather than issuing a separate request
+	static constexpr idx_t MINIMUM_HOLE_SIZE = 1 << 14;
+	static constexpr idx_t MAXIMUM_HOLE_SIZE = 1 << 23;
+	//! Bounds of the size up to which ranges are coalesced, larger reads are issued as separate (parallel) requests
+	static constexpr idx_t MINIMUM_RANGE_SIZE = 1 << 20;
+	static constexpr idx_t MAXIMUM_RANGE_SIZE = 1 << 26;
+
+public:
+	//! Records a request of the given size that took the given number of seconds
+	void RecordRequest(idx_t bytes, double seconds);
+
+	double GetLatency();
+	double GetBandwidth();
+
+	//! The number of bytes that can be read in the time it takes to issue a request: skipping a smaller gap between
+	//! two ranges is more expensive than reading it
+	idx_t HoleSizeLimit();
+	//! The size up to which ranges are coalesced - the latency is at most 10% of the time to read a range of this size
+	idx_t RangeSizeLimit();
+
+private:
+	mutex lock;
+	double latency = DEFAULT_LATENCY;
+	double bandwidth = DEFAULT_BANDWIDTH;
+	//! The (decayed) sums for the least squares fit of "seconds = latency + bytes / bandwidth"
+	idx_t samples = 0;
+	double sum_weight = 0;
+	double sum_bytes = 0;
+	double sum_seconds = 0;
+	double sum_bytes_squared = 0;
+	double sum_bytes_seconds = 0;
+};
+
+//! A bounded cache of the byte ranges that a scan reads ahead for the next row groups it scans. Ranges are kept until
+//! the scan has moved past them.
+class ParquetRangeCache {
+public:
+	explicit ParquetRangeCache(idx_t capacity);
+
+	//! Returns the cached buffer that contains [location, location + size), or nullptr if there is none. The offset of
+	//! the range within the buffer is written to buffer_offset.
+	shared_ptr<AllocatedData> Lookup(idx_t location, idx_t size, idx_t &buffer_offset);
+	//! Adds a range to the cache, evicting the ranges at the lowest offsets if the cache is full
+	void Insert(idx_t location, shared_ptr<AllocatedData> data);
+	//! Releases the ranges that end at or before the given offset
+	void Release(idx_t offset);
+
+	idx_t GetCachedBytes();
+
+private:
+	mutex lock;
+	idx_t capacity;
+	idx_t cached_bytes = 0;
+	//! The cached ranges, keyed by their offset in the file
+	map<idx_t, shared_ptr<AllocatedData>> ranges;
+};
+
+//! A read of a single (coalesced) byte range
+struct ParquetReadRequest {
+	ParquetReadRequest(data_ptr_t buffer, idx_t location, idx_t size) : buffer(buffer), location(location), size(size) {
+	}
+
+	data_ptr_t buffer;
+	idx_t location;
+	idx_t size;
+};
+
+//! The ParquetIOPlanner is shared by all scans of a file. It provides the cost model that decides which ranges are
+//! coalesced and read ahead, and issues the resulting requests in parallel.
+class ParquetIOPlanner {
+public:
+	//! The maximum number of bytes that a scan keeps in its range cache
+	static constexpr idx_t RANGE_CACHE_CAPACITY = 1 << 25;
+	//! The maximum number of row groups that are read ahead
+	static constexpr idx_t MAXIMUM_READAHEAD_ROW_GROUPS = 16;
+
+	explicit ParquetIOPlanner(TaskScheduler &scheduler);
+
+	ParquetIOCostModel &GetCostModel() {
+		return cost_model;
+	}
+
+	//! Reads a single range and records the time it took in the cost model
+	void Read(FileHandle &handle, ParquetReadRequest &request);
+	//! Reads a set of ranges, in parallel if there are multiple ranges and threads. The handle must support parallel
+	//! reads (i.e. be opened with FILE_FLAGS_PARALLEL_ACCESS).
+	void Read(FileHandle &handle, vector<ParquetReadRequest> &requests);
+
+private:
+	TaskScheduler &scheduler;
+	ParquetIOCostModel cost_model;
+};
+
+} // namespace duckdb
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_metadata_disk_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "parquet_file_metadata_cache.hpp"
+#include "parquet_types.h"
+
+namespace duckdb {
+class FileHandle;
+
+//! The ParquetMetadataDiskCache persists the footers (FileMetaData) of Parquet files in a local directory, so that the
+//! metadata of large collections of files does not have to be read again after a restart.
+//! Entries are keyed by the path of the file, and are validated in one of two ways:
+//! * by default, the last modified time and the size of the file must match the ones that were recorded
+//! * if parquet_metadata_cache_ttl is set, entries that are younger than the TTL are used without looking at the file
+//! The number of entries is bounded by parquet_metadata_cache_max_entries - the least recently written entries are
+//! removed first
+class ParquetMetadataDiskCache {
+public:
+	//! Returns the directory of the cache, or an empty string if the on-disk cache is disabled
+	static string GetDirectory(ClientContext &context);
+
+	//! Loads the metadata of a file from the on-disk cache, returns nullptr if there is no valid entry
+	static shared_ptr<ParquetFileMetadataCache> Load(ClientContext &context, FileHandle &file_handle);
+	//! Stores the metadata of a file in the on-disk cache
+	static void Store(ClientContext &context, FileHandle &file_handle,
+	                  const duckdb_parquet::format::FileMetaData &metadata, time_t read_time);
+
+	//! Loads the cached metadata of the given files into the object cache (if enabled)
+	//! Like Load, the entries are validated against the files unless a TTL is set
+	//! Returns the number of files for which metadata was loaded
+	static idx_t BulkLoad(ClientContext &context, const vector<string> &files);
+	//! Whether cached metadata can be used without checking if the file was modified, i.e. if the on-disk cache is
+	//! enabled with a TTL and the metadata was read less than the TTL ago
+	static bool IsFresh(ClientContext &context, const ParquetFileMetadataCache &metadata);
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/common/multi_file_reader_options.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -46,6 +47,29 @@ class ParquetEncryptionConfig;
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
+	// The default number of bytes per column chunk that are buffered at once, larger column chunks are streamed
+	static constexpr idx_t DEFAULT_COLUMN_BUFFER_SIZE = 1 << 26;
+	// The minimum column buffer size, which is the default page size of Parquet writers - a smaller buffer would
+	// mostly hold partial pages
+	static constexpr idx_t MINIMUM_COLUMN_BUFFER_SIZE = 1 << 20;
+};
+
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
+//! A table filter that is evaluated while scanning, keyed by the output column it applies to
+struct ParquetScanFilter {
+	ParquetScanFilter(idx_t filter_idx, TableFilter &filter) : filter_idx(filter_idx), filter(filter) {
+	}
+
+	idx_t filter_idx;
+	TableFilter &filter;
+	//! The dictionary the filter was last evaluated on, and which of its entries pass the filter
+	string dictionary_id;
+	vector<bool> dictionary_matches;
 };
 
 struct ParquetReaderScanState {
@@ -64,6 +88,17 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+	//! The number of bytes per column chunk that are buffered at once when prefetching
+	idx_t column_buffer_size = ParquetReaderPrefetchConfig::DEFAULT_COLUMN_BUFFER_SIZE;
+
+	//! Ranges of rows in the current row group that cannot match the filters according to the page index
+	vector<ParquetRowRange> skip_ranges;
+	idx_t skip_range_idx = 0;
+
+	//! The filters that are evaluated before the other columns are decoded
+	vector<ParquetScanFilter> scan_filters;
+	//! Reorders the evaluation of the scan filters at runtime, so the cheapest/most selective filter comes first
+	unique_ptr<AdaptiveFilter> adaptive_filter;
 };
 
 struct ParquetColumnDefinition {
@@ -143,6 +178,10 @@ public:
 
 public:
 	void InitializeScan(ClientContext &context, ParquetReaderScanState &state, vector<idx_t> groups_to_read);
+	//! Returns the row groups that a scan starting at the given row group should read: when prefetching, small row
+	//! groups that follow it are scanned along with it while reading them with the same request is cheaper than
+	//! issuing separate requests for them
+	vector<idx_t> GetScanGroups(ClientContext &context, idx_t group_idx);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
 
 	static unique_ptr<ParquetUnionData> StoreUnionReader(unique_ptr<ParquetReader> reader_p, idx_t file_idx) {
@@ -198,6 +237,8 @@ private:
 	              shared_ptr<ParquetFileMetadataCache> metadata);
 
 	void InitializeSchema(ClientContext &context);
+	//! Whether scans of the file manage the buffering of their reads themselves (remote files or prefetch_all)
+	bool UsePrefetchMode(ClientContext &context);
 	bool ScanInternal(ParquetReaderScanState &state, DataChunk &output);
 	unique_ptr<ColumnReader> CreateReader(ClientContext &context);
 
@@ -208,7 +249,14 @@ private:
 	idx_t GetGroupOffset(ParquetReaderScanState &state);
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
+	//! Register the row groups that the scan reads after the current one for prefetching, if reading them along with
+	//! the current row group is cheaper than issuing separate requests for them. Only the given column chunks are read
+	//! ahead, or the whole row groups if there are none.
+	void RegisterReadAhead(ParquetReaderScanState &state, ThriftFileTransport &trans, uint64_t read_bytes,
+	                       const vector<idx_t> &column_chunks);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Use the ColumnIndex/OffsetIndex of the current row group (if any) to find pages that can be skipped
+	void PreparePageIndex(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -219,6 +267,8 @@ private:
 
 private:
 	unique_ptr<FileHandle> file_handle;
+	//! Plans the (remote) reads of all scans of this file
+	shared_ptr<ParquetIOPlanner> io_planner;
 };
 
 } // namespace duckdb
@@ -61,6 +61,27 @@ public:
 		}
 	}
 
+	//! Skips over values without unpacking them
+	void Skip(uint32_t skip_count) {
+		while (skip_count > 0) {
+			if (repeat_count_ > 0) {
+				auto skip_batch = MinValue(skip_count, repeat_count_);
+				repeat_count_ -= skip_batch;
+				skip_count -= skip_batch;
+			} else if (literal_count_ > 0) {
+				auto skip_batch = MinValue(skip_count, literal_count_);
+				// advance the bit position within the bit-packed run
+				auto skip_bits = uint64_t(bitpack_pos) + uint64_t(skip_batch) * bit_width_;
+				buffer_.inc(skip_bits / ParquetDecodeUtils::BITPACK_DLEN);
+				bitpack_pos = UnsafeNumericCast<uint8_t>(skip_bits % ParquetDecodeUtils::BITPACK_DLEN);
+				literal_count_ -= skip_batch;
+				skip_count -= skip_batch;
+			} else if (!NextCounts<uint32_t>()) {
+				throw std::runtime_error("RLE decode did not find enough values");
+			}
+		}
+	}
+
 	static uint8_t ComputeBitWidth(idx_t val) {
 		if (val == 0) {
 			return 0;
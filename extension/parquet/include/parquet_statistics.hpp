@@ -18,6 +18,9 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transform a set of Parquet statistics (either of a column chunk or of a single page) of a non-nested column
+	static unique_ptr<BaseStatistics>
+	TransformColumnStatistics(const ColumnReader &reader, const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
@@ -10,6 +10,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
@@ -24,10 +25,13 @@
 #include "geo_parquet.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
 
+#include <condition_variable>
+
 namespace duckdb {
 class FileSystem;
 class FileOpener;
 class ParquetEncryptionConfig;
+class TaskScheduler;
 
 class Serializer;
 class Deserializer;
@@ -61,16 +65,44 @@ struct FieldID {
 	static FieldID Deserialize(Deserializer &source);
 };
 
+//! A (top-level) column by which the rows of every row group are sorted, written as the sorting_columns of the row
+//! groups. The sort order is declared by the user, the writer does not verify it.
+struct ParquetSortingColumn {
+	string name;
+	bool descending = false;
+	bool nulls_first = false;
+
+	void Serialize(Serializer &serializer) const;
+	static ParquetSortingColumn Deserialize(Deserializer &source);
+};
+
+//! The ColumnIndex and OffsetIndex of a column chunk, which are written after all row groups
+struct ParquetColumnPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The ColumnIndex is only written if there are statistics for all pages
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+};
+
 class ParquetWriter {
 public:
+	//! The default (uncompressed) size that pages are split at
+	static constexpr const idx_t DEFAULT_PAGE_SIZE_BYTES = 1 << 20;
+
 	ParquetWriter(ClientContext &context, FileSystem &fs, string file_name, vector<LogicalType> types,
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, vector<string> bloom_filter_columns,
+	              double bloom_filter_false_positive_ratio, optional_idx max_row_groups_in_flight,
+	              bool write_page_index, idx_t page_size_bytes, const vector<ParquetSortingColumn> &sorting_columns);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
+	//! Encodes the columns [col_idx, col_idx + count) of the row group
+	void PrepareColumns(ColumnDataCollection &buffer, vector<unique_ptr<ColumnWriterState>> &states, idx_t col_idx,
+	                    idx_t count);
 	void FlushRowGroup(PreparedRowGroup &row_group);
 	void Flush(ColumnDataCollection &buffer);
 	void Finalize();
@@ -103,6 +135,29 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Whether or not a Bloom filter should be written for the (top-level) column
+	bool HasBloomFilter(const vector<string> &schema_path) const {
+		// Bloom filters are not written for encrypted files
+		return !encryption_config && schema_path.size() == 1 &&
+		       bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
+	//! Whether or not the ColumnIndex/OffsetIndex of the column chunks are written
+	bool HasPageIndex() const {
+		// the page index of encrypted files would have to be encrypted with the column keys
+		return write_page_index && !encryption_config;
+	}
+	idx_t PageSizeBytes() const {
+		return page_size_bytes;
+	}
+	//! Adds the page index of a column chunk of the row group that is being flushed
+	void AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                  unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index);
+	//! Estimates the number of rows for which a row group has the given (compressed) size in the file, based on the
+	//! row groups that were written so far. Returns an invalid index if no row group was written yet.
+	optional_idx EstimateRowGroupRows(idx_t row_group_bytes) const;
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -116,6 +171,13 @@ public:
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
 
+private:
+	//! Waits until fewer than max_row_groups_in_flight row groups are being encoded
+	void BeginRowGroupEncoding();
+	void EndRowGroupEncoding();
+	//! Writes the ColumnIndex and OffsetIndex of all column chunks, and registers their location in the row groups
+	void WritePageIndexes();
+
 private:
 	string file_name;
 	vector<LogicalType> sql_types;
@@ -126,12 +188,30 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	unordered_set<string> bloom_filter_columns;
+	double bloom_filter_false_positive_ratio;
+	bool write_page_index;
+	idx_t page_size_bytes;
+	vector<duckdb_parquet::format::SortingColumn> sorting_columns;
 	shared_ptr<EncryptionUtil> encryption_util;
+	//! The scheduler that runs the tasks that encode the columns of a row group in parallel
+	TaskScheduler &scheduler;
+
+	//! The maximum number of row groups that are encoded at the same time (if set)
+	optional_idx max_row_groups_in_flight;
+	idx_t row_groups_in_flight = 0;
+	mutex in_flight_lock;
+	std::condition_variable in_flight_cv;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
 	duckdb_parquet::format::FileMetaData file_meta_data;
 	std::mutex lock;
+	//! The page indexes of the column chunks that were written
+	vector<ParquetColumnPageIndex> page_indexes;
+	//! The number of rows and (compressed) bytes of the row groups that were written
+	atomic<idx_t> written_rows;
+	atomic<idx_t> written_bytes;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
 
@@ -48,6 +48,9 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 	}
 
+	void GetColumnChunkIndexes(vector<idx_t> &result) const override {
+	}
+
 private:
 	idx_t row_group_offset;
 };
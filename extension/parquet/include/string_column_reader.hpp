@@ -31,7 +31,9 @@ public:
 	StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t schema_idx_p,
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
-	unsafe_unique_ptr<string_t[]> dict_strings;
+	//! The strings of the dictionary, followed by a NULL entry that null rows of dictionary vectors point to
+	unique_ptr<Vector> dict_strings;
+	idx_t dict_size = 0;
 	idx_t fixed_width_string_length;
 	idx_t delta_offset = 0;
 
@@ -48,6 +50,7 @@ public:
 protected:
 	void DictReference(Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
+	bool EmitDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) override;
 };
 
 } // namespace duckdb
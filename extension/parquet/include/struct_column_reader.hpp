@@ -35,6 +35,7 @@ public:
 	idx_t GroupRowsAvailable() override;
 	uint64_t TotalCompressedSize() override;
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override;
+	void GetColumnChunkIndexes(vector<idx_t> &result) const override;
 };
 
 } // namespace duckdb
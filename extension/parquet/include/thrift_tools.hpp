@@ -4,6 +4,7 @@
 #include "thrift/transport/TBufferTransports.h"
 
 #include "duckdb.hpp"
+#include "parquet_io_planner.hpp"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
@@ -13,84 +14,107 @@ namespace duckdb {
 
 // A ReadHead for prefetching data in a specific range
 struct ReadHead {
-	ReadHead(idx_t location, uint64_t size) : location(location), size(size) {};
+	ReadHead(idx_t location, uint64_t size, bool can_merge, bool cache)
+	    : location(location), size(size), can_merge(can_merge), cache(cache) {};
 	// Hint info
 	idx_t location;
 	uint64_t size;
+	// Whether the head can be coalesced with the heads around it
+	bool can_merge;
+	// Whether the head is read ahead for the next row groups of the scan, and should be put in the range cache
+	bool cache;
+
+	// If set, the head is streamed: at most this many bytes of the head are buffered at a time, in a window that moves
+	// forward as the head is read
+	idx_t window_size = 0;
 
 	// Current info
-	AllocatedData data;
+	shared_ptr<AllocatedData> buffer;
+	idx_t buffer_offset = 0;
 	bool data_isset = false;
+	// The range of the file that is buffered
+	idx_t data_location = 0;
+	idx_t data_size = 0;
 
 	idx_t GetEnd() const {
 		return size + location;
 	}
 
-	void Allocate(Allocator &allocator) {
-		data = allocator.Allocate(size);
+	bool IsStreamed() const {
+		return window_size > 0;
 	}
-};
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
-struct ReadHeadComparator {
-	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
-	bool operator()(const ReadHead *a, const ReadHead *b) const {
-		auto a_start = a->location;
-		auto a_end = a->location + a->size;
-		auto b_start = b->location;
+	// Whether [pos, pos + len) is buffered
+	bool IsBuffered(idx_t pos, idx_t len) const {
+		return data_isset && pos >= data_location && pos + len <= data_location + data_size;
+	}
+
+	// Returns the buffered data at the given position of the file
+	data_ptr_t GetData(idx_t pos) const {
+		D_ASSERT(IsBuffered(pos, 0));
+		return buffer->get() + buffer_offset + (pos - data_location);
+	}
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+	// Sets the range that is buffered by the next fetch: the entire head, or the window of a streamed head that starts
+	// at pos and contains at least len bytes
+	void SetDataRange(idx_t pos, idx_t len) {
+		if (!IsStreamed()) {
+			data_location = location;
+			data_size = size;
+			return;
 		}
+		data_location = pos;
+		data_size = MinValue<idx_t>(MaxValue<idx_t>(window_size, len), GetEnd() - pos);
+	}
 
-		return a_start < b_start && a_end < b_start;
+	void Allocate(Allocator &allocator) {
+		if (buffer && buffer.use_count() == 1 && buffer->GetSize() >= data_size) {
+			// the window of a streamed head moved forward - reuse its buffer
+			buffer_offset = 0;
+			return;
+		}
+		buffer = make_shared_ptr<AllocatedData>(allocator.Allocate(data_size));
+		buffer_offset = 0;
 	}
 };
 
 // Two-step read ahead buffer
-// 1: register all ranges that will be read, merging ranges that are consecutive
+// 1: register all ranges that will be read, coalescing ranges that are close to each other
 // 2: prefetch all registered ranges
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	// Without a planner, ranges that are within ALLOW_GAP bytes from each other are coalesced
+	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, shared_ptr<ParquetIOPlanner> planner_p)
+	    : allocator(allocator), handle(handle), planner(std::move(planner_p)),
+	      range_cache(ParquetIOPlanner::RANGE_CACHE_CAPACITY) {
 	}
 
 	// The list of read heads
 	std::list<ReadHead> read_heads;
-	// Set for merging consecutive ranges
-	std::set<ReadHead *, ReadHeadComparator> merge_set;
 
 	Allocator &allocator;
 	FileHandle &handle;
+	// The planner shared by all scans of the file (if any)
+	shared_ptr<ParquetIOPlanner> planner;
+	// The ranges that were read ahead for the next row groups of the scan
+	ParquetRangeCache range_cache;
 
 	idx_t total_size = 0;
 
 	// Add a read head to the prefetching list
-	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true) {
-		// Attempt to merge with existing
-		if (merge_buffers) {
-			ReadHead new_read_head {pos, len};
-			auto lookup_set = merge_set.find(&new_read_head);
-			if (lookup_set != merge_set.end()) {
-				auto existing_head = *lookup_set;
-				auto new_start = MinValue<idx_t>(existing_head->location, new_read_head.location);
-				auto new_length = MaxValue<idx_t>(existing_head->GetEnd(), new_read_head.GetEnd()) - new_start;
-				existing_head->location = new_start;
-				existing_head->size = new_length;
-				return;
-			}
+	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true, bool cache = false) {
+		if (pos + len > handle.GetFileSize()) {
+			throw std::runtime_error("Prefetch registered for bytes outside file");
 		}
-
-		read_heads.emplace_front(ReadHead(pos, len));
+		read_heads.emplace_front(pos, len, merge_buffers, cache);
 		total_size += len;
-		auto &read_head = read_heads.front();
-
-		if (merge_buffers) {
-			merge_set.insert(&read_head);
-		}
+	}
 
-		if (read_head.GetEnd() > handle.GetFileSize()) {
-			throw std::runtime_error("Prefetch registered for bytes outside file");
-		}
+	// Add a read head that is streamed through a window of window_size bytes, rather than buffered as a whole
+	void AddStreamedReadHead(idx_t pos, uint64_t len, idx_t window_size) {
+		AddReadHead(pos, len, false, false);
+		read_heads.front().window_size = window_size;
 	}
 
 	// Returns the relevant read head
@@ -103,17 +127,111 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Coalesce the read heads that can be merged and have not been fetched yet: overlapping and adjacent heads are
+	// always merged, heads separated by a gap only if reading the gap is cheaper than issuing another request
+	void Coalesce() {
+		uint64_t hole_size_limit = ALLOW_GAP;
+		uint64_t range_size_limit = NumericLimits<uint64_t>::Maximum();
+		if (planner) {
+			hole_size_limit = planner->GetCostModel().HoleSizeLimit();
+			range_size_limit = planner->GetCostModel().RangeSizeLimit();
+		}
+		read_heads.sort([](const ReadHead &a, const ReadHead &b) { return a.location < b.location; });
+		ReadHead *current = nullptr;
+		for (auto it = read_heads.begin(); it != read_heads.end();) {
+			auto &read_head = *it;
+			if (!read_head.can_merge || read_head.data_isset) {
+				it++;
+				continue;
+			}
+			if (current) {
+				auto merged_end = MaxValue<idx_t>(current->GetEnd(), read_head.GetEnd());
+				bool overlapping = read_head.location <= current->GetEnd();
+				if (overlapping || (read_head.location - current->GetEnd() <= hole_size_limit &&
+				                    merged_end - current->location <= range_size_limit)) {
+					current->size = merged_end - current->location;
+					current->cache = current->cache || read_head.cache;
+					it = read_heads.erase(it);
+					continue;
+				}
+			}
+			current = &read_head;
+			it++;
+		}
+	}
+
+	// Fetch a single read head, or the window of a streamed read head that contains [pos, pos + len)
+	void Fetch(ReadHead &read_head, idx_t pos, idx_t len) {
+		read_head.SetDataRange(pos, len);
+		if (TryFetchFromCache(read_head)) {
+			return;
+		}
+		read_head.Allocate(allocator);
+		auto data = read_head.buffer->get();
+		if (planner) {
+			ParquetReadRequest request(data, read_head.data_location, read_head.data_size);
+			planner->Read(handle, request);
+		} else {
+			handle.Read(data, read_head.data_size, read_head.data_location);
+		}
+		FinishFetch(read_head);
+	}
+
+	void Fetch(ReadHead &read_head) {
+		Fetch(read_head, read_head.location, 0);
+	}
+
+	// Prefetch all read heads that have not been fetched yet - of streamed heads only the first window is fetched
 	void Prefetch() {
+		vector<ParquetReadRequest> requests;
+		vector<reference<ReadHead>> fetched_heads;
 		for (auto &read_head : read_heads) {
+			if (read_head.data_isset) {
+				continue;
+			}
+			read_head.SetDataRange(read_head.location, 0);
+			if (TryFetchFromCache(read_head)) {
+				continue;
+			}
 			read_head.Allocate(allocator);
-
-			if (read_head.GetEnd() > handle.GetFileSize()) {
-				throw std::runtime_error("Prefetch registered requested for bytes outside file");
+			auto data = read_head.buffer->get();
+			if (!planner) {
+				handle.Read(data, read_head.data_size, read_head.data_location);
+				FinishFetch(read_head);
+				continue;
 			}
+			requests.emplace_back(data, read_head.data_location, read_head.data_size);
+			fetched_heads.push_back(read_head);
+		}
+		if (requests.empty()) {
+			return;
+		}
+		planner->Read(handle, requests);
+		for (auto &read_head : fetched_heads) {
+			FinishFetch(read_head.get());
+		}
+	}
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+private:
+	bool TryFetchFromCache(ReadHead &read_head) {
+		if (!planner) {
+			return false;
+		}
+		idx_t buffer_offset;
+		auto buffer = range_cache.Lookup(read_head.data_location, read_head.data_size, buffer_offset);
+		if (!buffer) {
+			return false;
+		}
+		read_head.buffer = std::move(buffer);
+		read_head.buffer_offset = buffer_offset;
+		read_head.data_isset = true;
+		return true;
+	}
+
+	void FinishFetch(ReadHead &read_head) {
+		read_head.data_isset = true;
+		if (planner && read_head.cache) {
+			range_cache.Insert(read_head.data_location, read_head.buffer);
 		}
 	}
 };
@@ -121,10 +239,15 @@ struct ReadAheadBuffer {
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
 public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
-
-	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
-	      prefetch_mode(prefetch_mode_p) {
+	// Sequential reads outside of the registered ranges grow the fallback buffer up to this size
+	static constexpr uint64_t PREFETCH_FALLBACK_MAXIMUM_BUFFERSIZE = 1 << 24;
+
+	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p,
+	                    shared_ptr<ParquetIOPlanner> planner = nullptr,
+	                    idx_t column_buffer_size_p = NumericLimits<idx_t>::Maximum())
+	    : handle(handle_p), location(0), ra_buffer(allocator, handle_p, std::move(planner)),
+	      prefetch_mode(prefetch_mode_p), column_buffer_size(column_buffer_size_p),
+	      fallback_size(PREFETCH_FALLBACK_BUFFERSIZE), fallback_end(0) {
 	}
 
 	uint32_t read(uint8_t *buf, uint32_t len) {
@@ -132,18 +255,25 @@ public:
 		if (prefetch_buffer != nullptr && location - prefetch_buffer->location + len <= prefetch_buffer->size) {
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
-			if (!prefetch_buffer->data_isset) {
-				prefetch_buffer->Allocate(allocator);
-				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
-				prefetch_buffer->data_isset = true;
+			if (!prefetch_buffer->IsBuffered(location, len)) {
+				// the head was not fetched yet, or the read moved past the window of a streamed head
+				ra_buffer.Fetch(*prefetch_buffer, location, len);
 			}
-			memcpy(buf, prefetch_buffer->data.get() + location - prefetch_buffer->location, len);
+			memcpy(buf, prefetch_buffer->GetData(location), len);
 		} else {
 			if (prefetch_mode && len < PREFETCH_FALLBACK_BUFFERSIZE && len > 0) {
-				Prefetch(location, MinValue<uint64_t>(PREFETCH_FALLBACK_BUFFERSIZE, handle.GetFileSize() - location));
+				// adaptive readahead: grow the buffer while the reads are sequential, reset it otherwise
+				if (location == fallback_end) {
+					fallback_size = MinValue<uint64_t>(fallback_size * 2, PREFETCH_FALLBACK_MAXIMUM_BUFFERSIZE);
+				} else {
+					fallback_size = PREFETCH_FALLBACK_BUFFERSIZE;
+				}
+				auto fallback_len = MinValue<uint64_t>(fallback_size, handle.GetFileSize() - location);
+				Prefetch(location, fallback_len);
+				fallback_end = location + fallback_len;
 				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location);
 				D_ASSERT(location - prefetch_buffer_fallback->location + len <= prefetch_buffer_fallback->size);
-				memcpy(buf, prefetch_buffer_fallback->data.get() + location - prefetch_buffer_fallback->location, len);
+				memcpy(buf, prefetch_buffer_fallback->GetData(location), len);
 			} else {
 				handle.Read(buf, len, location);
 			}
@@ -155,18 +285,27 @@ public:
 	// Prefetch a single buffer
 	void Prefetch(idx_t pos, uint64_t len) {
 		RegisterPrefetch(pos, len, false);
-		FinalizeRegistration();
-		PrefetchRegistered();
+		ra_buffer.Fetch(ra_buffer.read_heads.front());
 	}
 
 	// Register a buffer for prefixing
-	void RegisterPrefetch(idx_t pos, uint64_t len, bool can_merge = true) {
-		ra_buffer.AddReadHead(pos, len, can_merge);
+	void RegisterPrefetch(idx_t pos, uint64_t len, bool can_merge = true, bool cache = false) {
+		ra_buffer.AddReadHead(pos, len, can_merge, cache);
 	}
 
-	// Prevents any further merges, should be called before PrefetchRegistered
+	// Register a buffer that is streamed through a window of the column buffer size, rather than buffered as a whole
+	void RegisterStreamedPrefetch(idx_t pos, uint64_t len) {
+		ra_buffer.AddStreamedReadHead(pos, len, column_buffer_size);
+	}
+
+	// The maximum number of bytes of a column chunk that should be buffered at once
+	idx_t GetColumnBufferSize() const {
+		return column_buffer_size;
+	}
+
+	// Coalesces the registered ranges, should be called before PrefetchRegistered
 	void FinalizeRegistration() {
-		ra_buffer.merge_set.clear();
+		ra_buffer.Coalesce();
 	}
 
 	// Prefetch all previously registered ranges
@@ -176,7 +315,11 @@ public:
 
 	void ClearPrefetch() {
 		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+	}
+
+	// Release the read ahead ranges that end at or before the given offset, the scan has moved past them
+	void ReleaseReadAhead(idx_t offset) {
+		ra_buffer.range_cache.Release(offset);
 	}
 
 	void SetLocation(idx_t location_p) {
@@ -194,14 +337,18 @@ private:
 	FileHandle &handle;
 	idx_t location;
 
-	Allocator &allocator;
-
 	// Multi-buffer prefetch
 	ReadAheadBuffer ra_buffer;
 
 	// Whether the prefetch mode is enabled. In this mode the DirectIO flag of the handle will be set and the parquet
 	// reader will manage the read buffering.
 	bool prefetch_mode;
+	// The maximum number of bytes of a column chunk that are buffered at once, larger column chunks are streamed
+	idx_t column_buffer_size;
+
+	// The size of the next fallback buffer, and the end of the previous one
+	uint64_t fallback_size;
+	idx_t fallback_end;
 };
 
 } // namespace duckdb
@@ -0,0 +1,141 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/date.hpp"
+#endif
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_parquet::format::Type;
+
+constexpr const idx_t ParquetBloomFilter::BYTES_PER_BLOCK;
+constexpr const idx_t ParquetBloomFilter::MAX_BLOOM_FILTER_BYTES;
+constexpr const double ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO;
+
+//! The salts used to derive the bit to set in each of the eight words of a block
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes >= BYTES_PER_BLOCK && IsPowerOfTwo(num_bytes));
+	blocks.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+idx_t ParquetBloomFilter::OptimalNumOfBytes(idx_t num_distinct_values, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// m = -8 * ndv / ln(1 - p^(1/8)), see the Parquet specification
+	auto num_bits = -8.0 * static_cast<double>(num_distinct_values) /
+	                std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto num_bytes = static_cast<double>(MAX_BLOOM_FILTER_BYTES);
+	if (num_bits / 8.0 < num_bytes) {
+		num_bytes = num_bits / 8.0;
+	}
+	auto result = NextPowerOfTwo(static_cast<idx_t>(num_bytes));
+	return MinValue<idx_t>(MaxValue<idx_t>(result, BYTES_PER_BLOCK), MAX_BLOOM_FILTER_BYTES);
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+bool ParquetBloomFilter::TryHashConstant(const Value &constant, Type::type physical_type, uint64_t &result) {
+	if (constant.IsNull()) {
+		return false;
+	}
+	// the physical type determines the plain encoding of the values that were hashed by the writer
+	auto &type = constant.type();
+	switch (physical_type) {
+	case Type::INT32:
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+			result = Hash<int32_t>(constant.GetValue<int32_t>());
+			return true;
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			result = Hash<uint32_t>(constant.GetValue<uint32_t>());
+			return true;
+		case LogicalTypeId::DATE:
+			result = Hash<int32_t>(constant.GetValue<date_t>().days);
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+			result = Hash<int64_t>(constant.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			result = Hash<uint64_t>(constant.GetValue<uint64_t>());
+			return true;
+		default:
+			return false;
+		}
+	case Type::FLOAT: {
+		if (type.id() != LogicalTypeId::FLOAT) {
+			return false;
+		}
+		// zero and NaN compare equal to values with a different bit pattern (-0.0, other NaNs)
+		auto value = constant.GetValue<float>();
+		if (value == 0 || !Value::FloatIsFinite(value)) {
+			return false;
+		}
+		result = Hash<float>(value);
+		return true;
+	}
+	case Type::DOUBLE: {
+		if (type.id() != LogicalTypeId::DOUBLE) {
+			return false;
+		}
+		auto value = constant.GetValue<double>();
+		if (value == 0 || !Value::DoubleIsFinite(value)) {
+			return false;
+		}
+		result = Hash<double>(value);
+		return true;
+	}
+	case Type::BYTE_ARRAY:
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		} else {
+			auto &str = StringValue::Get(constant);
+			result = Hash(const_data_ptr_cast(str.c_str()), str.size());
+			return true;
+		}
+	default:
+		return false;
+	}
+}
+
+idx_t ParquetBloomFilter::BlockIndex(uint64_t hash) const {
+	auto num_blocks = blocks.size() / 8;
+	return ((hash >> 32) * num_blocks) >> 32;
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block = blocks.data() + BlockIndex(hash) * 8;
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FindHash(uint64_t hash) const {
+	auto block = blocks.data() + BlockIndex(hash) * 8;
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace duckdb
@@ -24,9 +24,12 @@ source_files = [
     for x in [
         'extension/parquet/column_reader.cpp',
         'extension/parquet/column_writer.cpp',
+        'extension/parquet/parquet_bloom_filter.cpp',
         'extension/parquet/parquet_crypto.cpp',
         'extension/parquet/parquet_extension.cpp',
+        'extension/parquet/parquet_io_planner.cpp',
         'extension/parquet/parquet_metadata.cpp',
+        'extension/parquet/parquet_metadata_disk_cache.cpp',
         'extension/parquet/parquet_reader.cpp',
         'extension/parquet/parquet_statistics.cpp',
         'extension/parquet/parquet_timestamp.cpp',
@@ -10,8 +10,10 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/query_node/bound_select_node.hpp"
 #include "geo_parquet.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_metadata.hpp"
+#include "parquet_metadata_disk_cache.hpp"
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
 #include "struct_column_reader.hpp"
@@ -25,6 +27,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -201,6 +204,23 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The (top-level) columns for which a split block Bloom filter is written
+	vector<string> bloom_filter_columns;
+	//! The false positive ratio that the Bloom filters are sized for
+	double bloom_filter_false_positive_ratio = ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO;
+
+	//! The maximum number of row groups that are encoded at the same time, which bounds the memory used for encoding
+	optional_idx max_row_groups_in_flight;
+
+	//! Whether or not to write the ColumnIndex/OffsetIndex of the column chunks
+	bool write_page_index = true;
+	//! The (uncompressed) size at which pages are split
+	idx_t page_size_bytes = ParquetWriter::DEFAULT_PAGE_SIZE_BYTES;
+	//! The target size of the row groups in the file (i.e. after encoding and compression)
+	optional_idx compressed_row_group_size_bytes;
+	//! The declared sort order of the rows in the row groups
+	vector<ParquetSortingColumn> sorting_columns;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -479,6 +499,8 @@ public:
 			// for more than one file, we could be lucky and metadata for *every* file is in the object cache (if
 			// enabled at all)
 			FileSystem &fs = FileSystem::GetFileSystem(context);
+			// fill the object cache with the metadata of the files that is persisted in the on-disk cache (if any)
+			ParquetMetadataDiskCache::BulkLoad(context, bind_data.file_list->GetAllFiles());
 
 			for (const auto &file_name : bind_data.file_list->Files()) {
 				auto metadata = cache.Get<ParquetFileMetadataCache>(file_name);
@@ -486,7 +508,9 @@ public:
 					// missing metadata entry in cache, no usable stats
 					return nullptr;
 				}
-				if (!fs.IsRemoteFile(file_name)) {
+				if (ParquetMetadataDiskCache::IsFresh(context, *metadata)) {
+					// the entry is within the TTL of the metadata cache: use it without looking at the file
+				} else if (!fs.IsRemoteFile(file_name)) {
 					auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 					// we need to check if the metadata cache entries are current
 					if (fs.GetLastModifiedTime(*handle) >= metadata->read_time) {
@@ -897,11 +921,11 @@ public:
 				if (parallel_state.row_group_index < current_reader_data.reader->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
 					scan_data.reader = current_reader_data.reader;
-					vector<idx_t> group_indexes {parallel_state.row_group_index};
-					scan_data.reader->InitializeScan(context, scan_data.scan_state, group_indexes);
+					auto group_indexes = scan_data.reader->GetScanGroups(context, parallel_state.row_group_index);
+					parallel_state.row_group_index += group_indexes.size();
+					scan_data.reader->InitializeScan(context, scan_data.scan_state, std::move(group_indexes));
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
 					return true;
 				} else {
 					// Close current file
@@ -1173,6 +1197,38 @@ static void GetFieldIDs(const Value &field_ids_value, ChildFieldIDs &field_ids,
 	}
 }
 
+static ParquetSortingColumn ParseSortingColumn(const string &sort_spec, const vector<string> &names,
+                                               const vector<LogicalType> &sql_types) {
+	// a sorting column is specified as "name [ASC|DESC] [NULLS FIRST|NULLS LAST]"
+	ParquetSortingColumn result;
+	auto spec = sort_spec;
+	StringUtil::Trim(spec);
+	auto lspec = StringUtil::Lower(spec);
+	if (StringUtil::EndsWith(lspec, " nulls first") || StringUtil::EndsWith(lspec, " nulls last")) {
+		result.nulls_first = StringUtil::EndsWith(lspec, " nulls first");
+		spec = spec.substr(0, lspec.rfind(" nulls "));
+		StringUtil::Trim(spec);
+		lspec = StringUtil::Lower(spec);
+	}
+	if (StringUtil::EndsWith(lspec, " asc") || StringUtil::EndsWith(lspec, " desc")) {
+		result.descending = StringUtil::EndsWith(lspec, " desc");
+		spec = spec.substr(0, lspec.rfind(' '));
+		StringUtil::Trim(spec);
+	}
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		if (!StringUtil::CIEquals(names[col_idx], spec)) {
+			continue;
+		}
+		if (sql_types[col_idx].IsNested()) {
+			throw BinderException("SORTING_COLUMNS only supports columns that are not nested, \"%s\" is a %s",
+			                      names[col_idx], sql_types[col_idx].ToString());
+		}
+		result.name = names[col_idx];
+		return result;
+	}
+	throw BinderException("Column \"%s\" referenced in SORTING_COLUMNS does not exist", spec);
+}
+
 unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBindInput &input,
                                           const vector<string> &names, const vector<LogicalType> &sql_types) {
 	D_ASSERT(names.size() == sql_types.size());
@@ -1180,8 +1236,37 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			// accepts either a column list, e.g. BLOOM_FILTER_COLUMNS (a, b), or a single LIST value
+			auto column_names = names;
+			vector<bool> bloom_filter_columns;
+			if (option.second.size() == 1 && option.second[0].type().id() == LogicalTypeId::LIST) {
+				bloom_filter_columns = ParseColumnList(option.second[0], column_names, loption);
+			} else {
+				bloom_filter_columns = ParseColumnList(option.second, column_names, loption);
+			}
+			bind_data->bloom_filter_columns.clear();
+			for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+				if (bloom_filter_columns[col_idx]) {
+					bind_data->bloom_filter_columns.push_back(names[col_idx]);
+				}
+			}
+			continue;
+		}
+		if (loption == "sorting_columns") {
+			// accepts either a list of sort specifications, e.g. SORTING_COLUMNS ('a', 'b DESC'), or a LIST value
+			vector<Value> sort_specs = option.second;
+			if (option.second.size() == 1 && option.second[0].type().id() == LogicalTypeId::LIST) {
+				sort_specs = ListValue::GetChildren(option.second[0]);
+			}
+			bind_data->sorting_columns.clear();
+			for (auto &sort_spec : sort_specs) {
+				bind_data->sorting_columns.push_back(ParseSortingColumn(sort_spec.ToString(), names, sql_types));
+			}
+			continue;
+		}
 		if (option.second.size() != 1) {
-			// All parquet write options require exactly one argument
+			// All other parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
 		}
 		if (loption == "row_group_size" || loption == "chunk_size") {
@@ -1194,8 +1279,36 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 				bind_data->row_group_size_bytes = option.second[0].GetValue<uint64_t>();
 			}
 			row_group_size_bytes_set = true;
+		} else if (loption == "compressed_row_group_size_bytes") {
+			auto roption = option.second[0];
+			if (roption.GetTypeMutable().id() == LogicalTypeId::VARCHAR) {
+				bind_data->compressed_row_group_size_bytes = DBConfig::ParseMemoryLimit(roption.ToString());
+			} else {
+				bind_data->compressed_row_group_size_bytes = roption.GetValue<uint64_t>();
+			}
+			if (bind_data->compressed_row_group_size_bytes.GetIndex() == 0) {
+				throw BinderException("COMPRESSED_ROW_GROUP_SIZE_BYTES must be greater than 0");
+			}
+		} else if (loption == "page_size_bytes") {
+			auto roption = option.second[0];
+			if (roption.GetTypeMutable().id() == LogicalTypeId::VARCHAR) {
+				bind_data->page_size_bytes = DBConfig::ParseMemoryLimit(roption.ToString());
+			} else {
+				bind_data->page_size_bytes = roption.GetValue<uint64_t>();
+			}
+			if (bind_data->page_size_bytes == 0) {
+				throw BinderException("PAGE_SIZE_BYTES must be greater than 0");
+			}
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = GetBooleanArgument(option);
 		} else if (loption == "row_groups_per_file") {
 			bind_data->row_groups_per_file = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "max_row_groups_in_flight") {
+			auto val = option.second[0].GetValue<uint64_t>();
+			if (val == 0) {
+				throw BinderException("max_row_groups_in_flight must be at least 1");
+			}
+			bind_data->max_row_groups_in_flight = val;
 		} else if (loption == "compression" || loption == "codec") {
 			const auto roption = StringUtil::Lower(option.second[0].ToString());
 			if (roption == "uncompressed") {
@@ -1273,10 +1386,21 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->compressed_row_group_size_bytes.IsValid() &&
+	    DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		throw BinderException("COMPRESSED_ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use "
+		                      "\"SET preserve_insertion_order=false;\" to disable preserving insertion order.");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1284,6 +1408,7 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 		}
 	} else {
 		// We always set a max row group size bytes so we don't use too much memory
+		// this also bounds row groups that are sized by COMPRESSED_ROW_GROUP_SIZE_BYTES when data compresses well
 		bind_data->row_group_size_bytes = bind_data->row_group_size * ParquetWriteBindData::BYTES_PER_ROW;
 	}
 
@@ -1302,7 +1427,10 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.bloom_filter_columns, parquet_bind.bloom_filter_false_positive_ratio,
+	                             parquet_bind.max_row_groups_in_flight, parquet_bind.write_page_index,
+	                             parquet_bind.page_size_bytes, parquet_bind.sorting_columns);
 	return std::move(global_state);
 }
 
@@ -1315,7 +1443,15 @@ void ParquetWriteSink(ExecutionContext &context, FunctionData &bind_data_p, Glob
 	// append data to the local (buffered) chunk collection
 	local_state.buffer.Append(local_state.append_state, input);
 
-	if (local_state.buffer.Count() >= bind_data.row_group_size ||
+	auto row_group_size = bind_data.row_group_size;
+	if (bind_data.compressed_row_group_size_bytes.IsValid()) {
+		// use the size of the row groups that were written so far to estimate how many rows fit in the target size
+		auto estimate = global_state.writer->EstimateRowGroupRows(bind_data.compressed_row_group_size_bytes.GetIndex());
+		if (estimate.IsValid()) {
+			row_group_size = estimate.GetIndex();
+		}
+	}
+	if (local_state.buffer.Count() >= row_group_size ||
 	    local_state.buffer.SizeInBytes() >= bind_data.row_group_size_bytes) {
 		// if the chunk collection exceeds a certain size (rows/bytes) we flush it to the parquet file
 		local_state.append_state.current_chunk_state.handles.clear();
@@ -1426,6 +1562,17 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<vector<string>>(112, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WriteProperty(113, "bloom_filter_false_positive_ratio", bind_data.bloom_filter_false_positive_ratio);
+	serializer.WritePropertyWithDefault<optional_idx>(114, "max_row_groups_in_flight",
+	                                                  bind_data.max_row_groups_in_flight);
+	serializer.WritePropertyWithDefault<bool>(115, "write_page_index", bind_data.write_page_index, true);
+	serializer.WritePropertyWithDefault<idx_t>(116, "page_size_bytes", bind_data.page_size_bytes,
+	                                           idx_t(ParquetWriter::DEFAULT_PAGE_SIZE_BYTES));
+	serializer.WritePropertyWithDefault<optional_idx>(117, "compressed_row_group_size_bytes",
+	                                                  bind_data.compressed_row_group_size_bytes);
+	serializer.WritePropertyWithDefault<vector<ParquetSortingColumn>>(118, "sorting_columns",
+	                                                                  bind_data.sorting_columns);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1445,6 +1592,19 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithDefault<bool>(111, "debug_use_openssl", true);
+	deserializer.ReadPropertyWithDefault<vector<string>>(112, "bloom_filter_columns", data->bloom_filter_columns);
+	deserializer.ReadPropertyWithDefault<double>(113, "bloom_filter_false_positive_ratio",
+	                                             data->bloom_filter_false_positive_ratio,
+	                                             double(ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO));
+	deserializer.ReadPropertyWithDefault<optional_idx>(114, "max_row_groups_in_flight",
+	                                                   data->max_row_groups_in_flight);
+	deserializer.ReadPropertyWithDefault<bool>(115, "write_page_index", data->write_page_index, true);
+	deserializer.ReadPropertyWithDefault<idx_t>(116, "page_size_bytes", data->page_size_bytes,
+	                                            idx_t(ParquetWriter::DEFAULT_PAGE_SIZE_BYTES));
+	deserializer.ReadPropertyWithDefault<optional_idx>(117, "compressed_row_group_size_bytes",
+	                                                   data->compressed_row_group_size_bytes);
+	deserializer.ReadPropertyWithDefault<vector<ParquetSortingColumn>>(118, "sorting_columns",
+	                                                                   data->sorting_columns);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1619,6 +1779,17 @@ static vector<unique_ptr<Expression>> ParquetWriteSelect(CopyToSelectInput &inpu
 	return {};
 }
 
+static void SetParquetColumnBufferSize(ClientContext &context, SetScope scope, Value &parameter) {
+	if (parameter.IsNull()) {
+		return;
+	}
+	auto column_buffer_size = UBigIntValue::Get(parameter);
+	if (column_buffer_size < ParquetReaderPrefetchConfig::MINIMUM_COLUMN_BUFFER_SIZE) {
+		throw InvalidInputException("parquet_column_buffer_size must be at least %llu bytes, got %llu",
+		                            ParquetReaderPrefetchConfig::MINIMUM_COLUMN_BUFFER_SIZE, column_buffer_size);
+	}
+}
+
 void ParquetExtension::Load(DuckDB &db) {
 	auto &db_instance = *db.instance;
 	auto &fs = db.GetFileSystem();
@@ -1677,6 +1848,27 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("prefetch_all_parquet_files",
+	                          "Use the prefetching mechanism for all types of parquet files, not only for remote files",
+	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("parquet_column_buffer_size",
+	                          "The maximum number of bytes of a column chunk that is buffered at once when prefetching "
+	                          "Parquet data, larger column chunks are streamed",
+	                          LogicalType::UBIGINT,
+	                          Value::UBIGINT(ParquetReaderPrefetchConfig::DEFAULT_COLUMN_BUFFER_SIZE),
+	                          SetParquetColumnBufferSize);
+	config.AddExtensionOption("parquet_metadata_cache_directory",
+	                          "Directory in which the metadata of Parquet files is cached across sessions (disabled if "
+	                          "empty)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("parquet_metadata_cache_ttl",
+	                          "If set, entries of the on-disk Parquet metadata cache that are younger than this number "
+	                          "of seconds are used without checking whether the file was modified (0 to always check)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("parquet_metadata_cache_max_entries",
+	                          "The maximum number of entries in the on-disk Parquet metadata cache, the least recently "
+	                          "written entries are removed when it is exceeded",
+	                          LogicalType::UBIGINT, Value::UBIGINT(100000));
 }
 
 std::string ParquetExtension::Name() {
@@ -0,0 +1,187 @@
+#include "parquet_io_planner.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#endif
+
+#include <chrono>
+
+namespace duckdb {
+
+constexpr double ParquetIOCostModel::DEFAULT_LATENCY;
+constexpr double ParquetIOCostModel::DEFAULT_BANDWIDTH;
+constexpr idx_t ParquetIOCostModel::MINIMUM_SAMPLES;
+constexpr double ParquetIOCostModel::SAMPLE_DECAY;
+constexpr idx_t ParquetIOCostModel::MINIMUM_HOLE_SIZE;
+constexpr idx_t ParquetIOCostModel::MAXIMUM_HOLE_SIZE;
+constexpr idx_t ParquetIOCostModel::MINIMUM_RANGE_SIZE;
+constexpr idx_t ParquetIOCostModel::MAXIMUM_RANGE_SIZE;
+constexpr idx_t ParquetIOPlanner::RANGE_CACHE_CAPACITY;
+constexpr idx_t ParquetIOPlanner::MAXIMUM_READAHEAD_ROW_GROUPS;
+
+//===--------------------------------------------------------------------===//
+// Cost Model
+//===--------------------------------------------------------------------===//
+void ParquetIOCostModel::RecordRequest(idx_t bytes, double seconds) {
+	lock_guard<mutex> guard(lock);
+	auto x = static_cast<double>(bytes);
+	sum_weight = sum_weight * SAMPLE_DECAY + 1;
+	sum_bytes = sum_bytes * SAMPLE_DECAY + x;
+	sum_seconds = sum_seconds * SAMPLE_DECAY + seconds;
+	sum_bytes_squared = sum_bytes_squared * SAMPLE_DECAY + x * x;
+	sum_bytes_seconds = sum_bytes_seconds * SAMPLE_DECAY + x * seconds;
+	samples++;
+	if (samples < MINIMUM_SAMPLES) {
+		return;
+	}
+	auto variance = sum_weight * sum_bytes_squared - sum_bytes * sum_bytes;
+	if (variance <= 0) {
+		// all requests had the same size - we cannot tell latency and bandwidth apart
+		return;
+	}
+	auto slope = (sum_weight * sum_bytes_seconds - sum_bytes * sum_seconds) / variance;
+	auto intercept = (sum_seconds - slope * sum_bytes) / sum_weight;
+	if (slope > 0) {
+		bandwidth = MinValue<double>(MaxValue<double>(1.0 / slope, 1024.0 * 1024.0), 1024.0 * 1024.0 * 1024.0 * 10.0);
+	}
+	latency = MinValue<double>(MaxValue<double>(intercept, 0.0001), 1.0);
+}
+
+double ParquetIOCostModel::GetLatency() {
+	lock_guard<mutex> guard(lock);
+	return latency;
+}
+
+double ParquetIOCostModel::GetBandwidth() {
+	lock_guard<mutex> guard(lock);
+	return bandwidth;
+}
+
+idx_t ParquetIOCostModel::HoleSizeLimit() {
+	lock_guard<mutex> guard(lock);
+	auto hole_size = static_cast<idx_t>(latency * bandwidth);
+	return MinValue<idx_t>(MaxValue<idx_t>(hole_size, MINIMUM_HOLE_SIZE), MAXIMUM_HOLE_SIZE);
+}
+
+idx_t ParquetIOCostModel::RangeSizeLimit() {
+	lock_guard<mutex> guard(lock);
+	auto range_size = static_cast<idx_t>(9.0 * latency * bandwidth);
+	return MinValue<idx_t>(MaxValue<idx_t>(range_size, MINIMUM_RANGE_SIZE), MAXIMUM_RANGE_SIZE);
+}
+
+//===--------------------------------------------------------------------===//
+// Range Cache
+//===--------------------------------------------------------------------===//
+ParquetRangeCache::ParquetRangeCache(idx_t capacity) : capacity(capacity) {
+}
+
+shared_ptr<AllocatedData> ParquetRangeCache::Lookup(idx_t location, idx_t size, idx_t &buffer_offset) {
+	lock_guard<mutex> guard(lock);
+	// find the last range that starts at or before the location
+	auto entry = ranges.upper_bound(location);
+	if (entry == ranges.begin()) {
+		return nullptr;
+	}
+	--entry;
+	if (location + size > entry->first + entry->second->GetSize()) {
+		return nullptr;
+	}
+	buffer_offset = location - entry->first;
+	return entry->second;
+}
+
+void ParquetRangeCache::Insert(idx_t location, shared_ptr<AllocatedData> data) {
+	auto size = data->GetSize();
+	if (size > capacity) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = ranges.upper_bound(location);
+	if (entry != ranges.begin()) {
+		auto previous = std::prev(entry);
+		if (location + size <= previous->first + previous->second->GetSize()) {
+			// the range is cached already
+			return;
+		}
+	}
+	// drop the ranges that are contained in the new range
+	entry = ranges.lower_bound(location);
+	while (entry != ranges.end() && entry->first + entry->second->GetSize() <= location + size) {
+		cached_bytes -= entry->second->GetSize();
+		entry = ranges.erase(entry);
+	}
+	// scans move forward through the file - evict the ranges at the lowest offsets first
+	while (!ranges.empty() && cached_bytes + size > capacity) {
+		cached_bytes -= ranges.begin()->second->GetSize();
+		ranges.erase(ranges.begin());
+	}
+	cached_bytes += size;
+	ranges[location] = std::move(data);
+}
+
+void ParquetRangeCache::Release(idx_t offset) {
+	lock_guard<mutex> guard(lock);
+	for (auto entry = ranges.begin(); entry != ranges.end() && entry->first < offset;) {
+		auto size = entry->second->GetSize();
+		if (entry->first + size > offset) {
+			entry++;
+			continue;
+		}
+		cached_bytes -= size;
+		entry = ranges.erase(entry);
+	}
+}
+
+idx_t ParquetRangeCache::GetCachedBytes() {
+	lock_guard<mutex> guard(lock);
+	return cached_bytes;
+}
+
+//===--------------------------------------------------------------------===//
+// Planner
+//===--------------------------------------------------------------------===//
+class ParquetReadRangeTask : public BaseExecutorTask {
+public:
+	ParquetReadRangeTask(TaskExecutor &executor, ParquetIOPlanner &planner, FileHandle &handle,
+	                     ParquetReadRequest &request)
+	    : BaseExecutorTask(executor), planner(planner), handle(handle), request(request) {
+	}
+
+	void ExecuteTask() override {
+		planner.Read(handle, request);
+	}
+
+private:
+	ParquetIOPlanner &planner;
+	FileHandle &handle;
+	ParquetReadRequest &request;
+};
+
+ParquetIOPlanner::ParquetIOPlanner(TaskScheduler &scheduler) : scheduler(scheduler) {
+}
+
+void ParquetIOPlanner::Read(FileHandle &handle, ParquetReadRequest &request) {
+	auto start = std::chrono::steady_clock::now();
+	handle.Read(request.buffer, request.size, request.location);
+	auto end = std::chrono::steady_clock::now();
+	cost_model.RecordRequest(request.size, std::chrono::duration<double>(end - start).count());
+}
+
+void ParquetIOPlanner::Read(FileHandle &handle, vector<ParquetReadRequest> &requests) {
+	if (requests.size() <= 1 || scheduler.NumberOfThreads() <= 1) {
+		for (auto &request : requests) {
+			Read(handle, request);
+		}
+		return;
+	}
+	// issue the requests in parallel - the requests are latency-bound so this thread participates as well
+	TaskExecutor executor(scheduler);
+	for (auto &request : requests) {
+		executor.ScheduleTask(make_uniq<ParquetReadRangeTask>(executor, *this, handle, request));
+	}
+	executor.WorkOnTasks();
+}
+
+} // namespace duckdb
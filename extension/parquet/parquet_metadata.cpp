@@ -37,6 +37,7 @@ public:
 	static void BindSchema(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindKeyValueMetaData(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindFileMetaData(vector<LogicalType> &return_types, vector<string> &names);
+	static LogicalType GetSortingColumnType();
 
 	void LoadRowGroupMetadata(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadSchemaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
@@ -164,6 +165,35 @@ void ParquetMetaDataOperatorData::BindMetaData(vector<LogicalType> &return_types
 
 	names.emplace_back("key_value_metadata");
 	return_types.emplace_back(LogicalType::MAP(LogicalType::BLOB, LogicalType::BLOB));
+
+	names.emplace_back("bloom_filter_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("column_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("column_index_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("offset_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("offset_index_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("row_group_sorting_columns");
+	return_types.emplace_back(LogicalType::LIST(GetSortingColumnType()));
+}
+
+LogicalType ParquetMetaDataOperatorData::GetSortingColumnType() {
+	child_list_t<LogicalType> children;
+	children.emplace_back("column_idx", LogicalType::INTEGER);
+	children.emplace_back("descending", LogicalType::BOOLEAN);
+	children.emplace_back("nulls_first", LogicalType::BOOLEAN);
+	return LogicalType::STRUCT(std::move(children));
 }
 
 Value ConvertParquetStats(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
@@ -298,6 +328,41 @@ void ParquetMetaDataOperatorData::LoadRowGroupMetadata(ClientContext &context, c
 			    23, count,
 			    Value::MAP(LogicalType::BLOB, LogicalType::BLOB, std::move(map_keys), std::move(map_values)));
 
+			// bloom_filter_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    24, count, ParquetElementBigint(col_meta.bloom_filter_offset, col_meta.__isset.bloom_filter_offset));
+
+			// bloom_filter_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    25, count, ParquetElementBigint(col_meta.bloom_filter_length, col_meta.__isset.bloom_filter_length));
+
+			// column_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    26, count, ParquetElementBigint(column.column_index_offset, column.__isset.column_index_offset));
+
+			// column_index_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    27, count, ParquetElementBigint(column.column_index_length, column.__isset.column_index_length));
+
+			// offset_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    28, count, ParquetElementBigint(column.offset_index_offset, column.__isset.offset_index_offset));
+
+			// offset_index_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    29, count, ParquetElementBigint(column.offset_index_length, column.__isset.offset_index_length));
+
+			// row_group_sorting_columns, LogicalType::LIST(STRUCT(column_idx, descending, nulls_first))
+			vector<Value> sorting_columns;
+			for (auto &sorting_column : row_group.sorting_columns) {
+				child_list_t<Value> values;
+				values.emplace_back("column_idx", Value::INTEGER(sorting_column.column_idx));
+				values.emplace_back("descending", Value::BOOLEAN(sorting_column.descending));
+				values.emplace_back("nulls_first", Value::BOOLEAN(sorting_column.nulls_first));
+				sorting_columns.push_back(Value::STRUCT(std::move(values)));
+			}
+			current_chunk.SetValue(30, count, Value::LIST(GetSortingColumnType(), std::move(sorting_columns)));
+
 			count++;
 			if (count >= STANDARD_VECTOR_SIZE) {
 				current_chunk.SetCardinality(count);
@@ -0,0 +1,341 @@
+#include "parquet_metadata_disk_cache.hpp"
+
+#include "geo_parquet.hpp"
+#include "thrift/protocol/TCompactProtocol.h"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#endif
+
+#include <chrono>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TCompactProtocolFactoryT;
+using duckdb_apache::thrift::transport::TTransport;
+using duckdb_parquet::format::FileMetaData;
+
+//! Identifies a cache entry - the version is bumped whenever the layout of an entry changes
+static constexpr const char *METADATA_CACHE_MAGIC = "DPMC";
+static constexpr const uint32_t METADATA_CACHE_VERSION = 1;
+
+//! (De)serializes thrift objects from/to a MemoryStream
+class MetadataCacheTransport : public TTransport {
+public:
+	explicit MetadataCacheTransport(MemoryStream &stream) : stream(stream) {
+	}
+
+	uint32_t read_virt(uint8_t *buf, uint32_t len) override {
+		stream.ReadData(buf, len);
+		return len;
+	}
+
+	void write_virt(const uint8_t *buf, uint32_t len) override {
+		stream.WriteData(const_data_ptr_cast(buf), len);
+	}
+
+private:
+	MemoryStream &stream;
+};
+
+//! The header of a cache entry, the (thrift encoded) FileMetaData follows the header
+struct MetadataCacheEntryHeader {
+	string path;
+	int64_t last_modified;
+	int64_t file_size;
+	int64_t read_time;
+
+	void Write(MemoryStream &stream) const {
+		stream.WriteData(const_data_ptr_cast(METADATA_CACHE_MAGIC), 4);
+		stream.Write<uint32_t>(METADATA_CACHE_VERSION);
+		stream.Write<uint32_t>(NumericCast<uint32_t>(path.size()));
+		stream.WriteData(const_data_ptr_cast(path.c_str()), path.size());
+		stream.Write<int64_t>(last_modified);
+		stream.Write<int64_t>(file_size);
+		stream.Write<int64_t>(read_time);
+	}
+
+	//! Reads the header, returns false if this is not a (compatible) cache entry
+	bool Read(MemoryStream &stream) {
+		char magic[4];
+		stream.ReadData(data_ptr_cast(magic), 4);
+		if (memcmp(magic, METADATA_CACHE_MAGIC, 4) != 0 || stream.Read<uint32_t>() != METADATA_CACHE_VERSION) {
+			return false;
+		}
+		auto path_size = stream.Read<uint32_t>();
+		path.resize(path_size);
+		stream.ReadData(data_ptr_cast(&path[0]), path_size);
+		last_modified = stream.Read<int64_t>();
+		file_size = stream.Read<int64_t>();
+		read_time = stream.Read<int64_t>();
+		return true;
+	}
+};
+
+static int64_t CurrentTime() {
+	return static_cast<int64_t>(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+}
+
+static idx_t GetTTL(ClientContext &context) {
+	Value ttl;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_ttl", ttl) && !ttl.IsNull()) {
+		return ttl.GetValue<uint64_t>();
+	}
+	return 0;
+}
+
+static idx_t GetMaxEntries(ClientContext &context) {
+	Value max_entries;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_max_entries", max_entries) && !max_entries.IsNull()) {
+		return max_entries.GetValue<uint64_t>();
+	}
+	return NumericLimits<idx_t>::Maximum();
+}
+
+//! Returns true if the entry is still valid for the given file - the file handle is only needed if no TTL is set
+static bool IsValidEntry(FileSystem &fs, optional_ptr<FileHandle> file_handle, const MetadataCacheEntryHeader &header,
+                         idx_t ttl) {
+	if (ttl > 0) {
+		// TTL-based validation: use the entry without looking at the file
+		return CurrentTime() - header.read_time < NumericCast<int64_t>(ttl);
+	}
+	// the file must not have been modified after the entry was written
+	return static_cast<int64_t>(fs.GetLastModifiedTime(*file_handle)) == header.last_modified &&
+	       fs.GetFileSize(*file_handle) == header.file_size;
+}
+
+//! Keeps track of the number of entries in the cache directory, so that we only list the directory when we need to
+//! remove entries
+class ParquetMetadataDiskCacheState : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "parquet_metadata_disk_cache_state";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	//! Registers a newly written entry, and removes the oldest entries if there are more than max_entries
+	void AddEntry(FileSystem &fs, const string &directory, idx_t max_entries) {
+		lock_guard<mutex> guard(lock);
+		if (directory != current_directory || !entry_count.IsValid()) {
+			current_directory = directory;
+			entry_count = ListEntries(fs, directory).size();
+		} else {
+			entry_count = entry_count.GetIndex() + 1;
+		}
+		if (entry_count.GetIndex() <= max_entries) {
+			return;
+		}
+		// remove the least recently written entries - we remove a quarter of the entries at once so that we don't
+		// have to list the directory again for every entry that is written
+		vector<pair<timestamp_t, string>> entries;
+		for (auto &entry_path : ListEntries(fs, directory)) {
+			try {
+				auto handle = fs.OpenFile(entry_path, FileFlags::FILE_FLAGS_READ);
+				entries.emplace_back(Timestamp::FromEpochSeconds(fs.GetLastModifiedTime(*handle)), entry_path);
+			} catch (std::exception &ex) {
+				// the entry might have been removed concurrently
+				continue;
+			}
+		}
+		std::sort(entries.begin(), entries.end());
+		auto target_count = max_entries - max_entries / 4;
+		idx_t removed = 0;
+		for (idx_t i = 0; i + target_count < entries.size(); i++) {
+			try {
+				fs.RemoveFile(entries[i].second);
+				removed++;
+			} catch (std::exception &ex) {
+				continue;
+			}
+		}
+		entry_count = entries.size() - removed;
+	}
+
+private:
+	static vector<string> ListEntries(FileSystem &fs, const string &directory) {
+		vector<string> result;
+		fs.ListFiles(directory, [&](const string &name, bool is_dir) {
+			if (!is_dir && StringUtil::EndsWith(name, ".parquet_metadata")) {
+				result.push_back(fs.JoinPath(directory, name));
+			}
+		});
+		return result;
+	}
+
+private:
+	mutex lock;
+	string current_directory;
+	//! The (approximate) number of entries in the directory - other processes can write entries as well
+	optional_idx entry_count;
+};
+
+static string GetEntryPath(FileSystem &fs, const string &directory, const string &path) {
+	return fs.JoinPath(directory, StringUtil::Format("%016llx.parquet_metadata", Hash(path.c_str())));
+}
+
+string ParquetMetadataDiskCache::GetDirectory(ClientContext &context) {
+	Value directory;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_directory", directory) && !directory.IsNull()) {
+		return directory.ToString();
+	}
+	return string();
+}
+
+//! Reads the entry of a file from the cache directory, returns nullptr if there is no (readable) entry
+static unique_ptr<FileMetaData> ReadEntry(FileSystem &fs, const string &directory, const string &path,
+                                          MetadataCacheEntryHeader &header) {
+	auto handle = fs.OpenFile(GetEntryPath(fs, directory, path),
+	                          FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!handle) {
+		return nullptr;
+	}
+	auto entry_size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+	auto buffer = make_unsafe_uniq_array<data_t>(entry_size);
+	handle->Read(buffer.get(), entry_size, 0);
+
+	MemoryStream stream(buffer.get(), entry_size);
+	// the path is stored in the entry as well, in case the hashes of two paths collide
+	if (!header.Read(stream) || header.path != path) {
+		return nullptr;
+	}
+	auto metadata = make_uniq<FileMetaData>();
+	TCompactProtocolFactoryT<MetadataCacheTransport> protocol_factory;
+	auto protocol = protocol_factory.getProtocol(std::make_shared<MetadataCacheTransport>(stream));
+	metadata->read(protocol.get());
+	return metadata;
+}
+
+shared_ptr<ParquetFileMetadataCache> ParquetMetadataDiskCache::Load(ClientContext &context, FileHandle &file_handle) {
+	auto directory = GetDirectory(context);
+	if (directory.empty()) {
+		return nullptr;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	unique_ptr<FileMetaData> metadata;
+	MetadataCacheEntryHeader header;
+	try {
+		metadata = ReadEntry(fs, directory, file_handle.path, header);
+	} catch (std::exception &ex) {
+		// the cache is best-effort: unreadable or corrupt entries are ignored and overwritten
+		return nullptr;
+	}
+	if (!metadata) {
+		return nullptr;
+	}
+	if (!IsValidEntry(fs, file_handle, header, GetTTL(context))) {
+		return nullptr;
+	}
+	auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
+	return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), static_cast<time_t>(header.read_time),
+	                                                 std::move(geo_metadata));
+}
+
+void ParquetMetadataDiskCache::Store(ClientContext &context, FileHandle &file_handle, const FileMetaData &metadata,
+                                     time_t read_time) {
+	auto directory = GetDirectory(context);
+	if (directory.empty()) {
+		return;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	MetadataCacheEntryHeader header;
+	header.path = file_handle.path;
+	header.last_modified = static_cast<int64_t>(fs.GetLastModifiedTime(file_handle));
+	header.file_size = fs.GetFileSize(file_handle);
+	header.read_time = static_cast<int64_t>(read_time);
+	if (header.last_modified + 10 >= header.read_time) {
+		// the file was modified very recently - it might still be modified within the resolution of the timestamp
+		return;
+	}
+	try {
+		MemoryStream stream;
+		header.Write(stream);
+		TCompactProtocolFactoryT<MetadataCacheTransport> protocol_factory;
+		auto protocol = protocol_factory.getProtocol(std::make_shared<MetadataCacheTransport>(stream));
+		metadata.write(protocol.get());
+
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+		// write the entry to a temporary file first, so concurrent readers never see a partially written entry
+		auto entry_path = GetEntryPath(fs, directory, header.path);
+		auto temp_path = entry_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+		{
+			auto handle = fs.OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			handle->Write(stream.GetData(), stream.GetPosition());
+			handle->Sync();
+		}
+		auto new_entry = !fs.FileExists(entry_path);
+		fs.MoveFile(temp_path, entry_path);
+		if (new_entry) {
+			auto &cache = ObjectCache::GetObjectCache(context);
+			auto state = cache.GetOrCreate<ParquetMetadataDiskCacheState>(ParquetMetadataDiskCacheState::ObjectType());
+			if (state) {
+				state->AddEntry(fs, directory, GetMaxEntries(context));
+			}
+		}
+	} catch (std::exception &ex) {
+		// failing to write the cache does not fail the query
+		return;
+	}
+}
+
+idx_t ParquetMetadataDiskCache::BulkLoad(ClientContext &context, const vector<string> &files) {
+	auto directory = GetDirectory(context);
+	if (directory.empty() || !ObjectCache::ObjectCacheEnabled(context)) {
+		return 0;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto ttl = GetTTL(context);
+	idx_t loaded = 0;
+	for (auto &file : files) {
+		if (cache.Get<ParquetFileMetadataCache>(file)) {
+			loaded++;
+			continue;
+		}
+		unique_ptr<FileMetaData> metadata;
+		MetadataCacheEntryHeader header;
+		try {
+			metadata = ReadEntry(fs, directory, file, header);
+		} catch (std::exception &ex) {
+			continue;
+		}
+		if (!metadata) {
+			continue;
+		}
+		try {
+			// validate the entry in the same way as Load does
+			unique_ptr<FileHandle> file_handle;
+			if (ttl == 0) {
+				file_handle = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ);
+			}
+			if (!IsValidEntry(fs, file_handle.get(), header, ttl)) {
+				continue;
+			}
+		} catch (std::exception &ex) {
+			continue;
+		}
+		auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
+		cache.Put(file, make_shared_ptr<ParquetFileMetadataCache>(
+		                    std::move(metadata), static_cast<time_t>(header.read_time), std::move(geo_metadata)));
+		loaded++;
+	}
+	return loaded;
+}
+
+bool ParquetMetadataDiskCache::IsFresh(ClientContext &context, const ParquetFileMetadataCache &metadata) {
+	auto ttl = GetTTL(context);
+	if (ttl == 0 || GetDirectory(context).empty()) {
+		return false;
+	}
+	return CurrentTime() - static_cast<int64_t>(metadata.read_time) < NumericCast<int64_t>(ttl);
+}
+
+} // namespace duckdb
@@ -8,8 +8,10 @@
 #include "expression_column_reader.hpp"
 #include "geo_parquet.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
+#include "parquet_metadata_disk_cache.hpp"
 #include "parquet_statistics.hpp"
 #include "parquet_timestamp.hpp"
 #include "mbedtls_wrapper.hpp"
@@ -26,6 +28,7 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -40,19 +43,25 @@
 
 namespace duckdb {
 
+using duckdb_parquet::format::BloomFilterHeader;
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static unique_ptr<duckdb_apache::thrift::protocol::TProtocol>
-CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode) {
-	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode);
+CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode,
+                         shared_ptr<ParquetIOPlanner> planner = nullptr,
+                         idx_t column_buffer_size = NumericLimits<idx_t>::Maximum()) {
+	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode, std::move(planner),
+	                                                       column_buffer_size);
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
@@ -62,6 +71,14 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
              const EncryptionUtil &encryption_util) {
 	auto current_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 
+	// the footers of encrypted files are never written to the on-disk cache
+	if (!encryption_config) {
+		auto cached_metadata = ParquetMetadataDiskCache::Load(context, file_handle);
+		if (cached_metadata) {
+			return cached_metadata;
+		}
+	}
+
 	auto file_proto = CreateThriftFileProtocol(allocator, file_handle, false);
 	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
 	auto file_size = transport.GetSize();
@@ -114,6 +131,7 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
 		ParquetCrypto::Read(*metadata, *file_proto, encryption_config->GetFooterKey(), encryption_util);
 	} else {
 		metadata->read(file_proto.get());
+		ParquetMetadataDiskCache::Store(context, file_handle, *metadata, current_time);
 	}
 
 	// Try to read the GeoParquet metadata (if present)
@@ -529,6 +547,7 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 		    "Reading parquet files from a FIFO stream is not supported and cannot be efficiently supported since "
 		    "metadata is located at the end of the file. Write the stream to disk first and read from there instead.");
 	}
+	io_planner = make_shared_ptr<ParquetIOPlanner>(TaskScheduler::GetScheduler(context_p));
 
 	// set pointer to factory method for AES state
 	auto &config = DBConfig::GetConfig(context_p);
@@ -546,9 +565,10 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 			metadata =
 			    LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config, *encryption_util);
 		} else {
-			auto last_modify_time = fs.GetLastModifiedTime(*file_handle);
 			metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file_name);
-			if (!metadata || (last_modify_time + 10 >= metadata->read_time)) {
+			// within the TTL of the metadata cache we use the entry without checking if the file was modified
+			if (!metadata || (!ParquetMetadataDiskCache::IsFresh(context_p, *metadata) &&
+			                  fs.GetLastModifiedTime(*file_handle) + 10 >= metadata->read_time)) {
 				metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
 				                        *encryption_util);
 				ObjectCache::GetObjectCache(context_p).Put(file_name, metadata);
@@ -663,8 +683,7 @@ uint64_t ParquetReader::GetGroupCompressedSize(ParquetReaderScanState &state) {
 	return total_compressed_size ? total_compressed_size : calc_compressed_size;
 }
 
-uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+static uint64_t GetRowGroupSpan(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 	idx_t max_offset = NumericLimits<idx_t>::Minimum();
 
@@ -686,8 +705,11 @@ uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
 	return max_offset - min_offset;
 }
 
-idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
+	return GetRowGroupSpan(GetGroup(state));
+}
+
+static idx_t GetRowGroupOffset(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 
 	for (auto &column_chunk : group.columns) {
@@ -703,6 +725,62 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
+	return GetRowGroupOffset(GetGroup(state));
+}
+
+static idx_t GetColumnChunkOffset(const ColumnChunk &column_chunk) {
+	auto min_offset = NumericCast<idx_t>(column_chunk.meta_data.data_page_offset);
+	if (column_chunk.meta_data.__isset.dictionary_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, NumericCast<idx_t>(column_chunk.meta_data.dictionary_page_offset));
+	}
+	if (column_chunk.meta_data.__isset.index_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, NumericCast<idx_t>(column_chunk.meta_data.index_page_offset));
+	}
+	return min_offset;
+}
+
+void ParquetReader::RegisterReadAhead(ParquetReaderScanState &state, ThriftFileTransport &trans, uint64_t read_bytes,
+                                      const vector<idx_t> &column_chunks) {
+	if (!io_planner) {
+		return;
+	}
+	// small row groups are dominated by the latency of the request: read the next row groups of this scan along with
+	// this one while that is cheaper than another request - they are found in the range cache when they are scanned
+	auto budget = io_planner->GetCostModel().HoleSizeLimit();
+	auto &row_groups = GetFileMetadata()->row_groups;
+	auto current_group = NumericCast<idx_t>(state.current_group);
+	auto last_group = MinValue<idx_t>(state.group_idx_list.size(),
+	                                  current_group + 1 + ParquetIOPlanner::MAXIMUM_READAHEAD_ROW_GROUPS);
+	for (idx_t list_idx = current_group + 1; list_idx < last_group; list_idx++) {
+		auto &next_group = row_groups[state.group_idx_list[list_idx]];
+		if (column_chunks.empty()) {
+			// read ahead the whole row group
+			auto next_span = GetRowGroupSpan(next_group);
+			if (read_bytes + next_span > budget) {
+				break;
+			}
+			trans.RegisterPrefetch(GetRowGroupOffset(next_group), next_span, true, true);
+			read_bytes += next_span;
+			continue;
+		}
+		// read ahead the column chunks that are scanned
+		uint64_t next_bytes = 0;
+		for (auto &chunk_idx : column_chunks) {
+			next_bytes += NumericCast<uint64_t>(next_group.columns[chunk_idx].meta_data.total_compressed_size);
+		}
+		if (read_bytes + next_bytes > budget) {
+			break;
+		}
+		for (auto &chunk_idx : column_chunks) {
+			auto &column_chunk = next_group.columns[chunk_idx];
+			trans.RegisterPrefetch(GetColumnChunkOffset(column_chunk),
+			                       NumericCast<uint64_t>(column_chunk.meta_data.total_compressed_size), true, true);
+		}
+		read_bytes += next_bytes;
+	}
+}
+
 static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
                                                       TableFilter &filter) {
 	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
@@ -717,6 +795,139 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+static FilterPropagateResult CheckParquetFilter(const ColumnReader &column_reader, BaseStatistics &stats,
+                                                const Statistics &pq_col_stats, TableFilter &filter) {
+	if (column_reader.Type().id() != LogicalTypeId::VARCHAR || !pq_col_stats.__isset.min_value ||
+	    !pq_col_stats.__isset.max_value) {
+		return filter.CheckStatistics(stats);
+	}
+	// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+	// however, when reading remote Parquet files, skipping row groups is really important
+	// here, we implement a special case to check the full length for string filters
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : and_filter.child_filters) {
+			auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+			if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+				break;
+			} else if (child_prune_result != and_result) {
+				and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return and_result;
+	}
+	return CheckParquetStringFilter(stats, pq_col_stats, filter);
+}
+
+//! Whether or not the filter contains equality comparisons that can be checked against a Bloom filter
+static bool CanUseBloomFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (CanUseBloomFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// e.g. an IN list - every alternative must be an equality comparison
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!CanUseBloomFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+//! Returns true if the Bloom filter proves that no value in the column chunk can satisfy the filter
+static bool BloomFilterExcludes(const ParquetBloomFilter &bloom_filter, const ColumnReader &column_reader,
+                                const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    constant_filter.constant.type() != column_reader.Type()) {
+			return false;
+		}
+		uint64_t hash;
+		if (!ParquetBloomFilter::TryHashConstant(constant_filter.constant, column_reader.Schema().type, hash)) {
+			return false;
+		}
+		return !bloom_filter.FindHash(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludes(bloom_filter, column_reader, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludes(bloom_filter, column_reader, *child_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+static unique_ptr<ParquetBloomFilter> ReadBloomFilter(ParquetReaderScanState &state, const ColumnChunk &column_chunk) {
+	auto &meta_data = column_chunk.meta_data;
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto offset = NumericCast<idx_t>(meta_data.bloom_filter_offset);
+	if (state.prefetch_mode && meta_data.__isset.bloom_filter_length) {
+		// fetch the header and the bitset with a single read
+		trans.Prefetch(offset, NumericCast<uint64_t>(meta_data.bloom_filter_length));
+	}
+	trans.SetLocation(offset);
+	BloomFilterHeader header;
+	header.read(state.thrift_file_proto.get());
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		// unsupported Bloom filter - ignore it
+		return nullptr;
+	}
+	if (header.numBytes < NumericCast<int32_t>(ParquetBloomFilter::BYTES_PER_BLOCK) ||
+	    header.numBytes > NumericCast<int32_t>(ParquetBloomFilter::MAX_BLOOM_FILTER_BYTES) ||
+	    !IsPowerOfTwo(NumericCast<idx_t>(header.numBytes))) {
+		throw InvalidInputException("Malformed parquet file: invalid Bloom filter size %d", header.numBytes);
+	}
+	auto result = make_uniq<ParquetBloomFilter>(NumericCast<idx_t>(header.numBytes));
+	trans.read(result->Data(), NumericCast<uint32_t>(result->Size()));
+	return result;
+}
+
+//! The column chunk of a top-level column, or nullptr for nested columns which consist of multiple column chunks
+static const ColumnChunk *GetColumnChunk(const ColumnReader &column_reader, const ParquetRowGroup &group) {
+	switch (column_reader.Type().id()) {
+	case LogicalTypeId::LIST:
+	case LogicalTypeId::MAP:
+	case LogicalTypeId::STRUCT:
+	case LogicalTypeId::ARRAY:
+		return nullptr;
+	default:
+		break;
+	}
+	return &group.columns[column_reader.FileIdx()];
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -732,38 +943,26 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
 
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
+			// nested columns and the file row number do not have a column chunk of their own
+			auto column_chunk = column_id == file_row_number_idx ? nullptr : GetColumnChunk(*column_reader, group);
+			if (column_chunk) {
+				auto prune_result =
+				    CheckParquetFilter(*column_reader, *stats, column_chunk->meta_data.statistics, filter);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
 				}
-			} else {
-				prune_result = filter.CheckStatistics(*stats);
-			}
-
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			} else if (filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
 			}
+			// for equality filters the Bloom filter can prune row groups that lie within the min/max of the column
+			if (!skip_chunk && column_chunk && column_chunk->meta_data.__isset.bloom_filter_offset &&
+			    !parquet_options.encryption_config && state.group_offset != NumericCast<idx_t>(group.num_rows) &&
+			    CanUseBloomFilter(filter)) {
+				auto bloom_filter = ReadBloomFilter(state, *column_chunk);
+				if (bloom_filter && BloomFilterExcludes(*bloom_filter, *column_reader, filter)) {
+					skip_chunk = true;
+				}
+			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
@@ -776,6 +975,135 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+static bool HasPageIndex(ColumnReader &column_reader, const ParquetRowGroup &group) {
+	auto column_chunk = GetColumnChunk(column_reader, group);
+	if (!column_chunk || column_reader.MaxRepeat() > 0) {
+		return false;
+	}
+	return column_chunk->__isset.offset_index_offset && column_chunk->__isset.offset_index_length;
+}
+
+static void ReadPageIndex(ParquetReaderScanState &state, int64_t offset, int32_t length,
+                          duckdb_apache::thrift::TBase &object) {
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	if (state.prefetch_mode) {
+		// fetch the index with a single read
+		trans.Prefetch(NumericCast<idx_t>(offset), NumericCast<uint64_t>(length));
+	}
+	trans.SetLocation(NumericCast<idx_t>(offset));
+	object.read(state.thrift_file_proto.get());
+}
+
+void ParquetReader::PreparePageIndex(ParquetReaderScanState &state) {
+	state.skip_ranges.clear();
+	state.skip_range_idx = 0;
+	if (!reader_data.filters || parquet_options.encryption_config) {
+		// the page index of encrypted files is encrypted with the column keys
+		return;
+	}
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// use the min/max of the individual pages of the filtered columns to find rows that cannot match the filters
+	vector<ParquetRowRange> ranges;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto file_col_idx = reader_data.column_ids[col_idx];
+		auto column_reader = root_reader.GetChildReader(file_col_idx);
+		if (file_col_idx == file_row_number_idx || !HasPageIndex(*column_reader, group)) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.column_index_length ||
+		    !column_reader->Stats(state.group_idx_list[state.current_group], group.columns)) {
+			continue;
+		}
+		ColumnIndex column_index;
+		OffsetIndex offset_index;
+		ReadPageIndex(state, column_chunk.column_index_offset, column_chunk.column_index_length, column_index);
+		ReadPageIndex(state, column_chunk.offset_index_offset, column_chunk.offset_index_length, offset_index);
+
+		auto &page_locations = offset_index.page_locations;
+		auto page_count = page_locations.size();
+		if (column_index.min_values.size() != page_count || column_index.max_values.size() != page_count ||
+		    column_index.null_pages.size() != page_count) {
+			continue;
+		}
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			if (column_index.null_pages[page_idx]) {
+				continue;
+			}
+			Statistics page_stats;
+			page_stats.__set_min_value(column_index.min_values[page_idx]);
+			page_stats.__set_max_value(column_index.max_values[page_idx]);
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(*column_reader, page_stats);
+			if (!stats) {
+				break;
+			}
+			auto prune_result = CheckParquetFilter(*column_reader, *stats, page_stats, *filter_entry->second);
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			ParquetRowRange range;
+			range.start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			range.end = page_idx + 1 < page_count ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			                                      : group_rows;
+			if (range.start < range.end && range.end <= group_rows) {
+				ranges.push_back(range);
+			}
+		}
+	}
+	if (ranges.empty()) {
+		return;
+	}
+
+	// the filters are AND-ed together, so we can skip the union of all ranges
+	std::sort(ranges.begin(), ranges.end(),
+	          [](const ParquetRowRange &a, const ParquetRowRange &b) { return a.start < b.start; });
+	for (auto &range : ranges) {
+		if (!state.skip_ranges.empty() && range.start <= state.skip_ranges.back().end) {
+			state.skip_ranges.back().end = MaxValue<idx_t>(state.skip_ranges.back().end, range.end);
+		} else {
+			state.skip_ranges.push_back(range);
+		}
+	}
+
+	// let the column readers jump over the skipped pages, and only prefetch the pages that are read
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto file_col_idx = reader_data.column_ids[col_idx];
+		auto column_reader = root_reader.GetChildReader(file_col_idx);
+		if (file_col_idx == file_row_number_idx || !HasPageIndex(*column_reader, group)) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		OffsetIndex offset_index;
+		ReadPageIndex(state, column_chunk.offset_index_offset, column_chunk.offset_index_length, offset_index);
+
+		auto &page_locations = offset_index.page_locations;
+		vector<bool> pages_to_read;
+		idx_t range_idx = 0;
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			auto page_end = page_idx + 1 < page_locations.size()
+			                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			                    : group_rows;
+			while (range_idx < state.skip_ranges.size() && state.skip_ranges[range_idx].end <= page_start) {
+				range_idx++;
+			}
+			// the page can be skipped if it is entirely contained in a skipped range
+			bool skip_page = range_idx < state.skip_ranges.size() &&
+			                 state.skip_ranges[range_idx].start <= page_start &&
+			                 state.skip_ranges[range_idx].end >= page_end;
+			pages_to_read.push_back(!skip_page);
+		}
+		column_reader->SetPageIndex(std::move(page_locations), std::move(pages_to_read));
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -784,6 +1112,36 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+bool ParquetReader::UsePrefetchMode(ClientContext &context) {
+	Value prefetch_all_files;
+	bool prefetch_all = context.TryGetCurrentSetting("prefetch_all_parquet_files", prefetch_all_files) &&
+	                    !prefetch_all_files.IsNull() && BooleanValue::Get(prefetch_all_files);
+	bool is_remote_file = !file_handle->OnDiskFile() && file_handle->CanSeek();
+	return is_remote_file || prefetch_all;
+}
+
+vector<idx_t> ParquetReader::GetScanGroups(ClientContext &context, idx_t group_idx) {
+	vector<idx_t> result {group_idx};
+	if (!io_planner || !UsePrefetchMode(context)) {
+		return result;
+	}
+	// leave enough row groups for the other threads
+	auto &row_groups = GetFileMetadata()->row_groups;
+	auto threads = MaxValue<idx_t>(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()), 1);
+	auto max_groups = MinValue<idx_t>(MaxValue<idx_t>((row_groups.size() - group_idx) / threads, 1),
+	                                  ParquetIOPlanner::MAXIMUM_READAHEAD_ROW_GROUPS + 1);
+	auto budget = io_planner->GetCostModel().HoleSizeLimit();
+	auto scan_bytes = GetRowGroupSpan(row_groups[group_idx]);
+	for (idx_t next_idx = group_idx + 1; next_idx < row_groups.size() && result.size() < max_groups; next_idx++) {
+		scan_bytes += GetRowGroupSpan(row_groups[next_idx]);
+		if (scan_bytes > budget) {
+			break;
+		}
+		result.push_back(next_idx);
+	}
+	return result;
+}
+
 void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanState &state,
                                    vector<idx_t> groups_to_read) {
 	state.current_group = -1;
@@ -794,9 +1152,14 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
 
-		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
+		bool is_remote_file = !file_handle->OnDiskFile() && file_handle->CanSeek();
+		if (UsePrefetchMode(context)) {
+			// the prefetched ranges are read in parallel from the same handle
 			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			flags |= FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
+			if (is_remote_file) {
+				flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			}
 		} else {
 			state.prefetch_mode = false;
 		}
@@ -804,10 +1167,31 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
 	}
 
-	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	Value column_buffer_size;
+	if (context.TryGetCurrentSetting("parquet_column_buffer_size", column_buffer_size) &&
+	    !column_buffer_size.IsNull()) {
+		state.column_buffer_size = UBigIntValue::Get(column_buffer_size);
+	}
+	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode,
+	                                                   state.prefetch_mode ? io_planner : nullptr,
+	                                                   state.column_buffer_size);
 	state.root_reader = CreateReader(context);
+	// top-level columns can emit dictionary vectors, nested columns are always flat
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (auto &file_col_idx : reader_data.column_ids) {
+		root_reader.GetChildReader(file_col_idx)->SetEmitDictionaryVectors(true);
+	}
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+
+	state.scan_filters.clear();
+	state.adaptive_filter.reset();
+	if (reader_data.filters && !reader_data.filters->filters.empty()) {
+		for (auto &entry : reader_data.filters->filters) {
+			state.scan_filters.emplace_back(entry.first, *entry.second);
+		}
+		state.adaptive_filter = make_uniq<AdaptiveFilter>(*reader_data.filters);
+	}
 }
 
 void FilterIsNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
@@ -1000,6 +1384,37 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	}
 }
 
+//! Applies a filter to a dictionary vector: the filter is evaluated once on the entries of the dictionary, and the
+//! result is reused for all vectors that reference the same dictionary
+static void ApplyDictionaryFilter(Vector &v, ParquetScanFilter &scan_filter, parquet_filter_t &filter_mask,
+                                  idx_t count) {
+	auto &dictionary_id = DictionaryVector::DictionaryId(v);
+	auto dictionary_size = DictionaryVector::DictionarySize(v).GetIndex();
+	if (scan_filter.dictionary_id.empty() || scan_filter.dictionary_id != dictionary_id) {
+		auto &dictionary = DictionaryVector::Child(v);
+		scan_filter.dictionary_matches.assign(dictionary_size, false);
+		for (idx_t offset = 0; offset < dictionary_size; offset += STANDARD_VECTOR_SIZE) {
+			auto entry_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, dictionary_size - offset);
+			Vector entries(dictionary, offset, offset + entry_count);
+			parquet_filter_t entry_mask;
+			for (idx_t i = 0; i < entry_count; i++) {
+				entry_mask.set(i);
+			}
+			ApplyFilter(entries, scan_filter.filter, entry_mask, entry_count);
+			for (idx_t i = 0; i < entry_count; i++) {
+				scan_filter.dictionary_matches[offset + i] = entry_mask.test(i);
+			}
+		}
+		scan_filter.dictionary_id = dictionary_id;
+	}
+	auto &sel = DictionaryVector::SelVector(v);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			filter_mask.set(i, scan_filter.dictionary_matches[sel.get_index(i)]);
+		}
+	}
+}
+
 void ParquetReader::Scan(ParquetReaderScanState &state, DataChunk &result) {
 	while (ScanInternal(state, result)) {
 		if (result.size() > 0) {
@@ -1027,6 +1442,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			state.finished = true;
 			return false;
 		}
+		if (state.prefetch_mode) {
+			trans.ReleaseReadAhead(GetGroupOffset(state));
+		}
 
 		uint64_t to_scan_compressed_bytes = 0;
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
@@ -1039,6 +1457,11 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		auto &group = GetGroup(state);
+		state.skip_ranges.clear();
+		state.skip_range_idx = 0;
+		if (state.group_offset != (idx_t)group.num_rows) {
+			PreparePageIndex(state);
+		}
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
@@ -1050,13 +1473,19 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				    "Malformed parquet file: sum of total compressed bytes of columns seems incorrect");
 			}
 
-			if (!reader_data.filters &&
+			// the whole row group is only buffered if it fits in the buffers of the scanned columns
+			auto column_count = MaxValue<idx_t>(reader_data.column_ids.size(), 1);
+			bool fits_column_buffers = total_row_group_span / column_count <= state.column_buffer_size;
+			if (!reader_data.filters && fits_column_buffers &&
 			    scan_percentage > ParquetReaderPrefetchConfig::WHOLE_GROUP_PREFETCH_MINIMUM_SCAN) {
 				// Prefetch the whole row group
 				if (!state.current_group_prefetched) {
 					auto total_compressed_size = GetGroupCompressedSize(state);
 					if (total_compressed_size > 0) {
-						trans.Prefetch(GetGroupOffset(state), total_row_group_span);
+						trans.RegisterPrefetch(GetGroupOffset(state), total_row_group_span);
+						RegisterReadAhead(state, trans, total_row_group_span, vector<idx_t>());
+						trans.FinalizeRegistration();
+						trans.PrefetchRegistered();
 					}
 					state.current_group_prefetched = true;
 				}
@@ -1066,6 +1495,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				bool lazy_fetch = reader_data.filters;
 
 				// Prefetch column-wise
+				vector<idx_t> column_chunks;
 				for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
 					auto file_col_idx = reader_data.column_ids[col_idx];
 					auto &root_reader = state.root_reader->Cast<StructColumnReader>();
@@ -1076,6 +1506,11 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 						has_filter = entry != reader_data.filters->filters.end();
 					}
 					root_reader.GetChildReader(file_col_idx)->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					root_reader.GetChildReader(file_col_idx)->GetColumnChunkIndexes(column_chunks);
+				}
+				if (!lazy_fetch && !column_chunks.empty()) {
+					// with lazy fetching the columns might not be read at all, so nothing is read ahead
+					RegisterReadAhead(state, trans, to_scan_compressed_bytes, column_chunks);
 				}
 
 				trans.FinalizeRegistration();
@@ -1088,7 +1523,36 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// skip over the rows that the page index tells us cannot match the filters
+	while (state.skip_range_idx < state.skip_ranges.size()) {
+		auto &skip_range = state.skip_ranges[state.skip_range_idx];
+		if (state.group_offset < skip_range.start) {
+			break;
+		}
+		state.skip_range_idx++;
+		if (state.group_offset >= skip_range.end) {
+			continue;
+		}
+		if (skip_range.end >= group_rows) {
+			// skip the rest of the row group
+			state.group_offset = group_rows;
+			return true;
+		}
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_range.end - state.group_offset);
+		}
+		state.group_offset = skip_range.end;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_rows - state.group_offset);
+	if (state.skip_range_idx < state.skip_ranges.size()) {
+		// stop at the start of the next skipped range
+		this_output_chunk_rows =
+		    MinValue<idx_t>(this_output_chunk_rows, state.skip_ranges[state.skip_range_idx].start - state.group_offset);
+	}
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1112,23 +1576,25 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
-	if (reader_data.filters) {
+	if (state.adaptive_filter) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
 		// first load the columns that are used in filters
-		for (auto &filter_col : reader_data.filters->filters) {
+		// the filter columns only decode the rows that passed the previous filters, and once no rows are left the
+		// remaining columns are skipped without decoding them
+		auto filter_state = state.adaptive_filter->BeginFilter();
+		for (idx_t i = 0; i < state.scan_filters.size(); i++) {
 			if (filter_mask.none()) {
 				// if no rows are left we can stop checking filters
 				break;
 			}
-			auto filter_entry = reader_data.filter_map[filter_col.first];
+			auto &scan_filter = state.scan_filters[state.adaptive_filter->permutation[i]];
+			auto filter_entry = reader_data.filter_map[scan_filter.filter_idx];
 			if (filter_entry.is_constant) {
 				// this is a constant vector, look for the constant
 				auto &constant = reader_data.constant_map[filter_entry.index].value;
 				Vector constant_vector(constant);
-				ApplyFilter(constant_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				ApplyFilter(constant_vector, scan_filter.filter, filter_mask, this_output_chunk_rows);
 			} else {
 				auto id = filter_entry.index;
 				auto file_col_idx = reader_data.column_ids[id];
@@ -1139,9 +1605,17 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				child_reader->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result_vector);
 				need_to_read[id] = false;
 
-				ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				if (result_vector.GetVectorType() == VectorType::DICTIONARY_VECTOR &&
+				    DictionaryVector::DictionarySize(result_vector).IsValid() &&
+				    !DictionaryVector::DictionaryId(result_vector).empty()) {
+					ApplyDictionaryFilter(result_vector, scan_filter, filter_mask, this_output_chunk_rows);
+				} else {
+					result_vector.Flatten(this_output_chunk_rows);
+					ApplyFilter(result_vector, scan_filter.filter, filter_mask, this_output_chunk_rows);
+				}
 			}
 		}
+		state.adaptive_filter->EndFilter(filter_state);
 
 		// we still may have to read some cols
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
@@ -15,6 +15,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #endif
@@ -319,11 +321,18 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             bool debug_use_openssl_p, vector<string> bloom_filter_columns_p,
+                             double bloom_filter_false_positive_ratio_p, optional_idx max_row_groups_in_flight_p,
+                             bool write_page_index_p, idx_t page_size_bytes_p,
+                             const vector<ParquetSortingColumn> &sorting_columns_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p),
+      bloom_filter_columns(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end()),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p), write_page_index(write_page_index_p),
+      page_size_bytes(page_size_bytes_p), scheduler(TaskScheduler::GetScheduler(context)),
+      max_row_groups_in_flight(max_row_groups_in_flight_p), written_rows(0), written_bytes(0) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -386,10 +395,76 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 	VerifyUniqueNames(unique_names);
 
 	vector<string> schema_path;
+	// the sorting columns refer to the leaf columns of the schema
+	vector<idx_t> leaf_indexes;
+	idx_t leaf_count = 0;
 	for (idx_t i = 0; i < sql_types.size(); i++) {
+		auto schema_start = file_meta_data.schema.size();
 		column_writers.push_back(ColumnWriter::CreateWriterRecursive(
 		    context, file_meta_data.schema, *this, sql_types[i], unique_names[i], schema_path, &field_ids));
+		leaf_indexes.push_back(leaf_count);
+		for (idx_t schema_idx = schema_start; schema_idx < file_meta_data.schema.size(); schema_idx++) {
+			if (file_meta_data.schema[schema_idx].num_children == 0) {
+				leaf_count++;
+			}
+		}
+	}
+	for (auto &sorting_column : sorting_columns_p) {
+		idx_t col_idx;
+		for (col_idx = 0; col_idx < column_names.size(); col_idx++) {
+			if (StringUtil::CIEquals(column_names[col_idx], sorting_column.name)) {
+				break;
+			}
+		}
+		if (col_idx == column_names.size() || sql_types[col_idx].IsNested()) {
+			throw BinderException("Sorting column \"%s\" must be a top-level column that is not nested",
+			                      sorting_column.name);
+		}
+		duckdb_parquet::format::SortingColumn result;
+		result.column_idx = NumericCast<int32_t>(leaf_indexes[col_idx]);
+		result.descending = sorting_column.descending;
+		result.nulls_first = sorting_column.nulls_first;
+		sorting_columns.push_back(result);
+	}
+}
+
+class ParquetPrepareColumnsTask : public BaseExecutorTask {
+public:
+	ParquetPrepareColumnsTask(TaskExecutor &executor, ParquetWriter &writer, ColumnDataCollection &buffer,
+	                          vector<unique_ptr<ColumnWriterState>> &states, idx_t col_idx, idx_t count)
+	    : BaseExecutorTask(executor), writer(writer), buffer(buffer), states(states), col_idx(col_idx), count(count) {
+	}
+
+	void ExecuteTask() override {
+		writer.PrepareColumns(buffer, states, col_idx, count);
+	}
+
+private:
+	ParquetWriter &writer;
+	ColumnDataCollection &buffer;
+	vector<unique_ptr<ColumnWriterState>> &states;
+	idx_t col_idx;
+	idx_t count;
+};
+
+void ParquetWriter::BeginRowGroupEncoding() {
+	if (!max_row_groups_in_flight.IsValid()) {
+		return;
+	}
+	std::unique_lock<mutex> guard(in_flight_lock);
+	in_flight_cv.wait(guard, [&]() { return row_groups_in_flight < max_row_groups_in_flight.GetIndex(); });
+	row_groups_in_flight++;
+}
+
+void ParquetWriter::EndRowGroupEncoding() {
+	if (!max_row_groups_in_flight.IsValid()) {
+		return;
+	}
+	{
+		lock_guard<mutex> guard(in_flight_lock);
+		row_groups_in_flight--;
 	}
+	in_flight_cv.notify_one();
 }
 
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
@@ -406,60 +481,86 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 	row_group.total_byte_size = NumericCast<int64_t>(buffer.SizeInBytes());
 	row_group.__isset.file_offset = true;
 
+	// initialize the write states up front, this registers the column chunks with the row group
 	auto &states = result.states;
-	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
-	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
-		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
-		vector<column_t> column_ids;
-		vector<reference<ColumnWriter>> col_writers;
-		vector<unique_ptr<ColumnWriterState>> write_states;
-		for (idx_t i = 0; i < next; i++) {
-			column_ids.emplace_back(col_idx + i);
-			col_writers.emplace_back(*column_writers[column_ids.back()]);
-			write_states.emplace_back(col_writers.back().get().InitializeWriteState(row_group));
-		}
+	for (auto &column_writer : column_writers) {
+		states.push_back(column_writer->InitializeWriteState(row_group));
+	}
 
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				if (col_writers[i].get().HasAnalyze()) {
-					col_writers[i].get().Analyze(*write_states[i], nullptr, chunk.data[i], chunk.size());
-				}
+	BeginRowGroupEncoding();
+	try {
+		auto column_count = buffer.ColumnCount();
+		if (column_count <= COLUMNS_PER_PASS || scheduler.NumberOfThreads() <= 1) {
+			for (idx_t col_idx = 0; col_idx < column_count; col_idx += COLUMNS_PER_PASS) {
+				PrepareColumns(buffer, states, col_idx, MinValue<idx_t>(column_count - col_idx, COLUMNS_PER_PASS));
 			}
+		} else {
+			// encode and compress the column chunks of wide row groups in parallel
+			TaskExecutor executor(scheduler);
+			for (idx_t col_idx = 0; col_idx < column_count; col_idx += COLUMNS_PER_PASS) {
+				auto count = MinValue<idx_t>(column_count - col_idx, COLUMNS_PER_PASS);
+				executor.ScheduleTask(
+				    make_uniq<ParquetPrepareColumnsTask>(executor, *this, buffer, states, col_idx, count));
+			}
+			executor.WorkOnTasks();
 		}
+	} catch (...) {
+		EndRowGroupEncoding();
+		throw;
+	}
+	EndRowGroupEncoding();
+	result.heaps = buffer.GetHeapReferences();
+}
+
+void ParquetWriter::PrepareColumns(ColumnDataCollection &buffer, vector<unique_ptr<ColumnWriterState>> &states,
+                                   idx_t col_idx, idx_t count) {
+	vector<column_t> column_ids;
+	vector<reference<ColumnWriter>> col_writers;
+	for (idx_t i = 0; i < count; i++) {
+		column_ids.emplace_back(col_idx + i);
+		col_writers.emplace_back(*column_writers[column_ids.back()]);
+	}
 
-		for (idx_t i = 0; i < next; i++) {
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < count; i++) {
 			if (col_writers[i].get().HasAnalyze()) {
-				col_writers[i].get().FinalizeAnalyze(*write_states[i]);
+				col_writers[i].get().Analyze(*states[col_idx + i], nullptr, chunk.data[i], chunk.size());
 			}
 		}
+	}
 
-		// Reserving these once at the start really pays off
-		for (auto &write_state : write_states) {
-			write_state->definition_levels.reserve(buffer.Count());
+	for (idx_t i = 0; i < count; i++) {
+		if (col_writers[i].get().HasAnalyze()) {
+			col_writers[i].get().FinalizeAnalyze(*states[col_idx + i]);
 		}
+	}
 
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Prepare(*write_states[i], nullptr, chunk.data[i], chunk.size());
-			}
-		}
+	// Reserving these once at the start really pays off
+	for (idx_t i = 0; i < count; i++) {
+		states[col_idx + i]->definition_levels.reserve(buffer.Count());
+	}
 
-		for (idx_t i = 0; i < next; i++) {
-			col_writers[i].get().BeginWrite(*write_states[i]);
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < count; i++) {
+			col_writers[i].get().Prepare(*states[col_idx + i], nullptr, chunk.data[i], chunk.size());
 		}
+	}
 
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Write(*write_states[i], chunk.data[i], chunk.size());
-			}
-		}
+	for (idx_t i = 0; i < count; i++) {
+		col_writers[i].get().BeginWrite(*states[col_idx + i]);
+	}
 
-		for (auto &write_state : write_states) {
-			states.push_back(std::move(write_state));
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < count; i++) {
+			col_writers[i].get().Write(*states[col_idx + i], chunk.data[i], chunk.size());
 		}
 	}
-	result.heaps = buffer.GetHeapReferences();
+
+	// compress the remaining pages, so that only writing the pages to the file happens while holding the lock
+	for (idx_t i = 0; i < count; i++) {
+		col_writers[i].get().EndWrite(*states[col_idx + i]);
+	}
 }
 
 // Validation code adapted from Impala
@@ -513,7 +614,12 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	}
 	// let's make sure all offsets are ay-okay
 	ValidateColumnOffsets(file_name, writer->GetTotalWritten(), row_group);
+	written_rows += NumericCast<idx_t>(row_group.num_rows);
+	written_bytes += writer->GetTotalWritten() - NumericCast<idx_t>(row_group.file_offset);
 
+	if (!sorting_columns.empty()) {
+		row_group.__set_sorting_columns(sorting_columns);
+	}
 	// append the row group to the file meta data
 	file_meta_data.row_groups.push_back(row_group);
 	file_meta_data.num_rows += row_group.num_rows;
@@ -533,7 +639,52 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                 unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index) {
+	// this is called while the row group is flushed (i.e. while holding the lock)
+	ParquetColumnPageIndex page_index;
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_index.column_idx = column_idx;
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+	page_indexes.push_back(std::move(page_index));
+}
+
+optional_idx ParquetWriter::EstimateRowGroupRows(idx_t row_group_bytes) const {
+	auto rows = written_rows.load();
+	auto bytes = written_bytes.load();
+	if (rows == 0 || bytes == 0) {
+		return optional_idx();
+	}
+	auto estimate = static_cast<double>(row_group_bytes) * static_cast<double>(rows) / static_cast<double>(bytes);
+	return MaxValue<idx_t>(LossyNumericCast<idx_t>(estimate), 1);
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// like other writers, we write all ColumnIndexes followed by all OffsetIndexes right before the footer
+	for (auto &page_index : page_indexes) {
+		if (!page_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*page_index.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*page_index.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WritePageIndexes();
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
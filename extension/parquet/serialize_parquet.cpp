@@ -10,6 +10,7 @@
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
 #include "parquet_writer.hpp"
+#include "parquet_writer.hpp"
 
 namespace duckdb {
 
@@ -85,4 +86,18 @@ ParquetOptions ParquetOptions::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void ParquetSortingColumn::Serialize(Serializer &serializer) const {
+	serializer.WritePropertyWithDefault<string>(100, "name", name);
+	serializer.WritePropertyWithDefault<bool>(101, "descending", descending);
+	serializer.WritePropertyWithDefault<bool>(102, "nulls_first", nulls_first);
+}
+
+ParquetSortingColumn ParquetSortingColumn::Deserialize(Deserializer &deserializer) {
+	ParquetSortingColumn result;
+	deserializer.ReadPropertyWithDefault<string>(100, "name", result.name);
+	deserializer.ReadPropertyWithDefault<bool>(101, "descending", result.descending);
+	deserializer.ReadPropertyWithDefault<bool>(102, "nulls_first", result.nulls_first);
+	return result;
+}
+
 } // namespace duckdb
@@ -2,11 +2,23 @@
 
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
 
 #include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#if defined(MADV_HUGEPAGE)
+#define DUCKDB_HUGE_PAGES_SUPPORTED
+#endif
+#endif
 
 #ifdef DUCKDB_DEBUG_ALLOCATION
 #include "duckdb/common/mutex.hpp"
@@ -177,7 +189,7 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 	return new_pointer;
 }
 
-data_ptr_t Allocator::DefaultAllocate(PrivateAllocatorData *private_data, idx_t size) {
+static data_ptr_t DefaultAllocateInternal(PrivateAllocatorData *private_data, idx_t size) {
 #ifdef USE_JEMALLOC
 	return JemallocExtension::Allocate(private_data, size);
 #else
@@ -189,7 +201,7 @@ data_ptr_t Allocator::DefaultAllocate(PrivateAllocatorData *private_data, idx_t
 #endif
 }
 
-void Allocator::DefaultFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+static void DefaultFreeInternal(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
 #ifdef USE_JEMALLOC
 	JemallocExtension::Free(private_data, pointer, size);
 #else
@@ -197,8 +209,8 @@ void Allocator::DefaultFree(PrivateAllocatorData *private_data, data_ptr_t point
 #endif
 }
 
-data_ptr_t Allocator::DefaultReallocate(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
-                                        idx_t size) {
+static data_ptr_t DefaultReallocateInternal(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
+                                            idx_t size) {
 #ifdef USE_JEMALLOC
 	return JemallocExtension::Reallocate(private_data, pointer, old_size, size);
 #else
@@ -206,6 +218,247 @@ data_ptr_t Allocator::DefaultReallocate(PrivateAllocatorData *private_data, data
 #endif
 }
 
+//===--------------------------------------------------------------------===//
+// Huge Pages
+//===--------------------------------------------------------------------===//
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+//! A huge-page aligned chunk that is divided into slots of equal size
+struct HugePageChunk {
+	idx_t slot_size;
+	//! Bitmask of the free slots in the chunk
+	uint64_t free_mask;
+};
+
+//! HugePageAllocator backs allocations with (transparent) huge pages
+//! Allocations that are at least one huge page in size are advised to be backed by huge pages. Smaller allocations
+//! of a power-of-two size (e.g. the blocks of the buffer pool) are carved out of huge-page aligned chunks, which are
+//! pooled so that freed slots are re-used by later allocations of the same size.
+class HugePageAllocator {
+public:
+	//! The smallest allocation that is carved out of a chunk - a chunk has at most 64 slots
+	static constexpr const idx_t MINIMUM_SLOT_SIZE = Allocator::HUGE_PAGE_SIZE / 64;
+
+	static HugePageAllocator &Get() {
+		// the allocator is never destroyed, as memory can be freed during static destruction
+		static auto instance = new HugePageAllocator(); // NOLINT: intentionally leaked
+		return *instance;
+	}
+
+	static bool IsSlotSize(idx_t size) {
+		return size >= MINIMUM_SLOT_SIZE && size < Allocator::HUGE_PAGE_SIZE && (size & (size - 1)) == 0;
+	}
+
+	data_ptr_t AllocateSlot(idx_t size) {
+		lock_guard<mutex> guard(lock);
+		auto &partial = partial_chunks[size];
+		data_ptr_t chunk;
+		if (partial.empty()) {
+			void *chunk_ptr;
+			if (posix_memalign(&chunk_ptr, Allocator::HUGE_PAGE_SIZE, Allocator::HUGE_PAGE_SIZE) != 0) {
+				return nullptr;
+			}
+			madvise(chunk_ptr, Allocator::HUGE_PAGE_SIZE, MADV_HUGEPAGE);
+			chunk = data_ptr_cast(chunk_ptr);
+			chunks[chunk] = HugePageChunk {size, FullMask(size)};
+			partial.insert(chunk);
+			chunk_memory += Allocator::HUGE_PAGE_SIZE;
+		} else {
+			chunk = *partial.begin();
+		}
+		auto &info = chunks[chunk];
+		auto slot = CountZeros<uint64_t>::Trailing(info.free_mask);
+		info.free_mask &= ~(uint64_t(1) << slot);
+		if (info.free_mask == 0) {
+			partial.erase(chunk);
+		}
+		slot_memory += size;
+		return chunk + slot * size;
+	}
+
+	//! Returns true if the pointer was allocated as a slot of a chunk
+	bool IsSlot(data_ptr_t pointer, idx_t size) {
+		if (!IsSlotSize(size) || chunk_memory == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		return chunks.find(GetChunk(pointer)) != chunks.end();
+	}
+
+	//! Frees the pointer if it was allocated as a slot of a chunk - returns false otherwise
+	bool FreeSlot(data_ptr_t pointer, idx_t size) {
+		if (!IsSlotSize(size) || chunk_memory == 0) {
+			return false;
+		}
+		auto chunk = GetChunk(pointer);
+		lock_guard<mutex> guard(lock);
+		auto entry = chunks.find(chunk);
+		if (entry == chunks.end()) {
+			return false;
+		}
+		auto &info = entry->second;
+		D_ASSERT(info.slot_size == size);
+		auto &partial = partial_chunks[info.slot_size];
+		auto slot = NumericCast<idx_t>(pointer - chunk) / info.slot_size;
+		bool was_full = info.free_mask == 0;
+		info.free_mask |= uint64_t(1) << slot;
+		slot_memory -= info.slot_size;
+		if (info.free_mask == FullMask(info.slot_size) && partial.size() > 1) {
+			// the chunk is empty and there are other chunks with free slots - release it
+			partial.erase(chunk);
+			chunks.erase(entry);
+			free(chunk);
+			chunk_memory -= Allocator::HUGE_PAGE_SIZE;
+		} else if (was_full) {
+			partial.insert(chunk);
+		}
+		return true;
+	}
+
+	//! Advise the kernel to back the huge-page aligned part of a large allocation with huge pages
+	void Advise(data_ptr_t pointer, idx_t size) {
+		auto start = AlignValue<uintptr_t, Allocator::HUGE_PAGE_SIZE>(CastPointerToValue(pointer));
+		auto end = AlignValueFloor<uintptr_t, Allocator::HUGE_PAGE_SIZE>(CastPointerToValue(pointer) + size);
+		if (end <= start) {
+			return;
+		}
+		if (madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE) != 0) {
+			return;
+		}
+		lock_guard<mutex> guard(lock);
+		advised_allocations[pointer] = end - start;
+		advised_memory += end - start;
+	}
+
+	//! Stop tracking a large allocation that is freed
+	void Forget(data_ptr_t pointer, idx_t size) {
+		if (size < Allocator::HUGE_PAGE_SIZE || advised_memory == 0) {
+			return;
+		}
+		lock_guard<mutex> guard(lock);
+		auto entry = advised_allocations.find(pointer);
+		if (entry == advised_allocations.end()) {
+			return;
+		}
+		advised_memory -= entry->second;
+		advised_allocations.erase(entry);
+	}
+
+	HugePageInformation GetInformation() {
+		HugePageInformation result;
+		result.enabled = enabled;
+		result.chunk_memory = chunk_memory;
+		result.slot_memory = slot_memory;
+		result.advised_memory = advised_memory;
+		return result;
+	}
+
+public:
+	//! Whether or not new allocations are backed by huge pages
+	atomic<bool> enabled {false};
+
+private:
+	static uint64_t FullMask(idx_t slot_size) {
+		auto slot_count = Allocator::HUGE_PAGE_SIZE / slot_size;
+		return slot_count == 64 ? NumericLimits<uint64_t>::Maximum() : (uint64_t(1) << slot_count) - 1;
+	}
+	static data_ptr_t GetChunk(data_ptr_t pointer) {
+		return reinterpret_cast<data_ptr_t>(
+		    AlignValueFloor<uintptr_t, Allocator::HUGE_PAGE_SIZE>(CastPointerToValue(pointer)));
+	}
+
+	mutex lock;
+	//! The chunks that are divided into slots
+	unordered_map<data_ptr_t, HugePageChunk> chunks;
+	//! The chunks with free slots, per slot size
+	unordered_map<idx_t, unordered_set<data_ptr_t>> partial_chunks;
+	//! The large allocations that were advised to be backed by huge pages
+	unordered_map<data_ptr_t, idx_t> advised_allocations;
+	//! The total size of the chunks
+	atomic<idx_t> chunk_memory {0};
+	//! The size of the slots that are in use
+	atomic<idx_t> slot_memory {0};
+	//! The size of the advised parts of the large allocations
+	atomic<idx_t> advised_memory {0};
+};
+#endif
+
+bool Allocator::SupportsHugePages() {
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+	return true;
+#else
+	return false;
+#endif
+}
+
+void Allocator::SetHugePages(bool enable) {
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+	HugePageAllocator::Get().enabled = enable;
+#endif
+}
+
+HugePageInformation Allocator::GetHugePageInformation() {
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+	return HugePageAllocator::Get().GetInformation();
+#else
+	return HugePageInformation();
+#endif
+}
+
+data_ptr_t Allocator::DefaultAllocate(PrivateAllocatorData *private_data, idx_t size) {
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+	auto &huge_pages = HugePageAllocator::Get();
+	if (huge_pages.enabled) {
+		if (HugePageAllocator::IsSlotSize(size)) {
+			auto result = huge_pages.AllocateSlot(size);
+			if (result) {
+				return result;
+			}
+		}
+		auto result = DefaultAllocateInternal(private_data, size);
+		if (result && size >= HUGE_PAGE_SIZE) {
+			huge_pages.Advise(result, size);
+		}
+		return result;
+	}
+#endif
+	return DefaultAllocateInternal(private_data, size);
+}
+
+void Allocator::DefaultFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+	auto &huge_pages = HugePageAllocator::Get();
+	if (huge_pages.FreeSlot(pointer, size)) {
+		return;
+	}
+	huge_pages.Forget(pointer, size);
+#endif
+	DefaultFreeInternal(private_data, pointer, size);
+}
+
+data_ptr_t Allocator::DefaultReallocate(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
+                                        idx_t size) {
+#ifdef DUCKDB_HUGE_PAGES_SUPPORTED
+	auto &huge_pages = HugePageAllocator::Get();
+	if (huge_pages.IsSlot(pointer, old_size)) {
+		// slots cannot be resized in-place - move the data to a new allocation
+		auto result = DefaultAllocate(private_data, size);
+		if (result) {
+			memcpy(result, pointer, MinValue<idx_t>(old_size, size));
+			DefaultFree(private_data, pointer, old_size);
+		}
+		return result;
+	}
+	huge_pages.Forget(pointer, old_size);
+	auto result = DefaultReallocateInternal(private_data, pointer, old_size, size);
+	if (result && huge_pages.enabled && size >= HUGE_PAGE_SIZE) {
+		huge_pages.Advise(result, size);
+	}
+	return result;
+#else
+	return DefaultReallocateInternal(private_data, pointer, old_size, size);
+#endif
+}
+
 shared_ptr<Allocator> &Allocator::DefaultAllocatorReference() {
 	static shared_ptr<Allocator> DEFAULT_ALLOCATOR = make_shared_ptr<Allocator>();
 	return DEFAULT_ALLOCATOR;
@@ -1074,6 +1074,8 @@ const char* EnumUtil::ToChars<CheckpointAbort>(CheckpointAbort value) {
 		return "DEBUG_ABORT_BEFORE_HEADER";
 	case CheckpointAbort::DEBUG_ABORT_AFTER_FREE_LIST_WRITE:
 		return "DEBUG_ABORT_AFTER_FREE_LIST_WRITE";
+	case CheckpointAbort::DEBUG_ABORT_IN_ROW_GROUP_WRITE:
+		return "DEBUG_ABORT_IN_ROW_GROUP_WRITE";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -1093,6 +1095,9 @@ CheckpointAbort EnumUtil::FromString<CheckpointAbort>(const char *value) {
 	if (StringUtil::Equals(value, "DEBUG_ABORT_AFTER_FREE_LIST_WRITE")) {
 		return CheckpointAbort::DEBUG_ABORT_AFTER_FREE_LIST_WRITE;
 	}
+	if (StringUtil::Equals(value, "DEBUG_ABORT_IN_ROW_GROUP_WRITE")) {
+		return CheckpointAbort::DEBUG_ABORT_IN_ROW_GROUP_WRITE;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -18,6 +18,7 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <unistd.h>
 #else
@@ -523,6 +524,39 @@ bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_
 #endif
 }
 
+bool LocalFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+#if defined(__linux__)
+	// POSIX_FADV_WILLNEED schedules the reads without waiting for them to complete
+	// multiple ranges can be in flight at the same time, which allows the device to process them in parallel
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	int res = posix_fadvise(fd, UnsafeNumericCast<off_t>(location), UnsafeNumericCast<off_t>(nr_bytes),
+	                        POSIX_FADV_WILLNEED);
+	return res == 0;
+#else
+	return false;
+#endif
+}
+
+data_ptr_t LocalFileSystem::MapFile(FileHandle &handle, idx_t nr_bytes) {
+	if (nr_bytes == 0) {
+		return nullptr;
+	}
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	// a private mapping shares the clean pages with the page cache (and thus with other processes mapping the file)
+	// writes to the mapping never reach the file
+	auto mapping = mmap(nullptr, nr_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (mapping == MAP_FAILED) {
+		return nullptr;
+	}
+	return static_cast<data_ptr_t>(mapping);
+}
+
+void LocalFileSystem::UnmapFile(FileHandle &handle, data_ptr_t mapping, idx_t nr_bytes) {
+	if (munmap(mapping, nr_bytes) != 0) {
+		throw IOException("Could not unmap file \"%s\": %s", handle.path, strerror(errno));
+	}
+}
+
 int64_t LocalFileSystem::GetFileSize(FileHandle &handle) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	struct stat s;
@@ -963,6 +997,20 @@ bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_
 	return false;
 }
 
+bool LocalFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// TODO: Not yet implemented on windows.
+	return false;
+}
+
+data_ptr_t LocalFileSystem::MapFile(FileHandle &handle, idx_t nr_bytes) {
+	// TODO: Not yet implemented on windows.
+	return nullptr;
+}
+
+void LocalFileSystem::UnmapFile(FileHandle &handle, data_ptr_t mapping, idx_t nr_bytes) {
+	throw NotImplementedException("UnmapFile is not implemented on Windows");
+}
+
 int64_t LocalFileSystem::GetFileSize(FileHandle &handle) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	LARGE_INTEGER result;
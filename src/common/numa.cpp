@@ -0,0 +1,113 @@
+#include "duckdb/common/numa.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace duckdb {
+
+NUMATopology NUMATopology::Detect(FileSystem &fs) {
+	NUMATopology result;
+#ifdef __linux__
+	static constexpr const char *node_directory = "/sys/devices/system/node";
+	if (!fs.DirectoryExists(node_directory)) {
+		return result;
+	}
+	// find the NUMA nodes - these are the "nodeN" directories
+	vector<idx_t> nodes;
+	fs.ListFiles(node_directory, [&](const string &name, bool is_directory) {
+		if (!is_directory || !StringUtil::StartsWith(name, "node")) {
+			return;
+		}
+		idx_t node;
+		if (TryCast::Operation<string_t, idx_t>(string_t(name.substr(4)), node)) {
+			nodes.push_back(node);
+		}
+	});
+	std::sort(nodes.begin(), nodes.end());
+	// only consider the CPUs the process is allowed to run on (e.g., when started with taskset or numactl)
+	cpu_set_t allowed_cpus;
+	CPU_ZERO(&allowed_cpus);
+	bool has_allowed_cpus = sched_getaffinity(0, sizeof(cpu_set_t), &allowed_cpus) == 0;
+	for (auto &node : nodes) {
+		auto cpu_list_path = fs.JoinPath(node_directory, StringUtil::Format("node%llu/cpulist", node));
+		if (!fs.FileExists(cpu_list_path)) {
+			continue;
+		}
+		auto handle = fs.OpenFile(cpu_list_path, FileFlags::FILE_FLAGS_READ);
+		char buffer[4096];
+		auto bytes_read = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+		buffer[bytes_read] = '\0';
+		vector<idx_t> cpus;
+		for (auto &cpu : ParseCPUList(buffer)) {
+			if (!has_allowed_cpus || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed_cpus))) {
+				cpus.push_back(cpu);
+			}
+		}
+		if (cpus.empty()) {
+			// memory-only node, or none of the CPUs of the node can be used
+			continue;
+		}
+		result.node_cpus.push_back(std::move(cpus));
+	}
+#endif
+	return result;
+}
+
+vector<idx_t> NUMATopology::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(cpu_list, ',')) {
+		StringUtil::Trim(range);
+		if (range.empty()) {
+			continue;
+		}
+		// either a single CPU ("4") or an inclusive range of CPUs ("0-3")
+		auto dash_pos = range.find('-');
+		auto start_str = range.substr(0, dash_pos);
+		auto end_str = dash_pos == string::npos ? start_str : range.substr(dash_pos + 1);
+		idx_t start, end;
+		if (!TryCast::Operation<string_t, idx_t>(string_t(start_str), start) ||
+		    !TryCast::Operation<string_t, idx_t>(string_t(end_str), end) || start > end) {
+			return vector<idx_t>();
+		}
+		for (idx_t cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+vector<idx_t> NUMATopology::GetThreadCPUs(ThreadPinMode mode, idx_t thread_idx) const {
+	if (node_cpus.empty()) {
+		return vector<idx_t>();
+	}
+	auto &cpus = node_cpus[thread_idx % node_cpus.size()];
+	switch (mode) {
+	case ThreadPinMode::AUTO:
+		if (node_cpus.size() == 1) {
+			// a single NUMA node - no need to pin the threads
+			return vector<idx_t>();
+		}
+		return cpus;
+	case ThreadPinMode::ON: {
+		auto cpu_idx = (thread_idx / node_cpus.size()) % cpus.size();
+		return vector<idx_t> {cpus[cpu_idx]};
+	}
+	default:
+		return vector<idx_t>();
+	}
+}
+
+vector<idx_t> NUMATopology::GetAllCPUs() const {
+	vector<idx_t> result;
+	for (auto &cpus : node_cpus) {
+		result.insert(result.end(), cpus.begin(), cpus.end());
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -216,6 +216,13 @@ void Vector::Slice(const Vector &other, idx_t offset, idx_t end) {
 	}
 }
 
+void Vector::Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count) {
+	D_ASSERT(dict.GetVectorType() == VectorType::FLAT_VECTOR);
+	Reference(dict);
+	Slice(sel, count);
+	buffer->Cast<DictionaryBuffer>().SetDictionarySize(dictionary_size);
+}
+
 void Vector::Slice(const Vector &other, const SelectionVector &sel, idx_t count) {
 	Reference(other);
 	Slice(sel, count);
@@ -228,9 +235,15 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	}
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		// already a dictionary, slice the current dictionary
-		auto &current_sel = DictionaryVector::SelVector(*this);
-		auto sliced_dictionary = current_sel.Slice(sel, count);
-		buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		auto &current_buffer = buffer->Cast<DictionaryBuffer>();
+		auto sliced_dictionary = current_buffer.GetSelVector().Slice(sel, count);
+		auto dict_buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		// the sliced vector still references the same dictionary
+		if (current_buffer.GetDictionarySize().IsValid()) {
+			dict_buffer->SetDictionarySize(current_buffer.GetDictionarySize().GetIndex());
+		}
+		dict_buffer->SetDictionaryId(current_buffer.GetDictionaryId());
+		buffer = std::move(dict_buffer);
 		if (GetType().InternalType() == PhysicalType::STRUCT) {
 			auto &child_vector = DictionaryVector::Child(*this);
 
@@ -267,7 +280,13 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 		auto entry = cache.cache.find(target_data);
 		if (entry != cache.cache.end()) {
 			// cached entry exists: use that
-			this->buffer = make_buffer<DictionaryBuffer>(entry->second->Cast<DictionaryBuffer>().GetSelVector());
+			auto &cached_buffer = entry->second->Cast<DictionaryBuffer>();
+			auto dict_buffer = make_buffer<DictionaryBuffer>(cached_buffer.GetSelVector());
+			if (cached_buffer.GetDictionarySize().IsValid()) {
+				dict_buffer->SetDictionarySize(cached_buffer.GetDictionarySize().GetIndex());
+			}
+			dict_buffer->SetDictionaryId(cached_buffer.GetDictionaryId());
+			this->buffer = std::move(dict_buffer);
 			vector_type = VectorType::DICTIONARY_VECTOR;
 		} else {
 			Slice(sel, count);
@@ -128,8 +128,13 @@ unique_ptr<GlobalSinkState> PhysicalOperator::GetGlobalSinkState(ClientContext &
 idx_t PhysicalOperator::GetMaxThreadMemory(ClientContext &context) {
 	// Memory usage per thread should scale with max mem / num threads
 	// We take 1/4th of this, to be conservative
-	auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	auto &client_config = ClientConfig::GetConfig(context);
+	auto max_memory = MinValue(BufferManager::GetBufferManager(context).GetQueryMaxMemory(),
+	                           client_config.query_max_memory);
 	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	if (client_config.query_max_threads != 0) {
+		num_threads = MinValue(num_threads, client_config.query_max_threads);
+	}
 	return (max_memory / num_threads) / 4;
 }
 
@@ -0,0 +1,82 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/block_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBDatabaseMemoryData : public GlobalTableFunctionState {
+	DuckDBDatabaseMemoryData() : offset(0) {
+	}
+
+	vector<reference<AttachedDatabase>> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBDatabaseMemoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("database_oid");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_reservation_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBDatabaseMemoryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBDatabaseMemoryData>();
+
+	// collect all databases that store their blocks in the buffer pool
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &entry : databases) {
+		auto &attached = entry.get();
+		if (attached.IsSystem() || attached.IsTemporary() || !attached.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		result->entries.push_back(attached);
+	}
+	return std::move(result);
+}
+
+void DuckDBDatabaseMemoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBDatabaseMemoryData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &attached = data.entries[data.offset++].get();
+		auto &block_manager = attached.GetStorageManager().GetBlockManager();
+		// return values:
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, attached.GetName());
+		// database_oid, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(attached.oid)));
+		// memory_usage_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(block_manager.GetMemoryUsage())));
+		// memory_reservation_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(block_manager.GetMemoryReservation())));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBDatabaseMemoryFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_database_memory", {}, DuckDBDatabaseMemoryFunction,
+	                              DuckDBDatabaseMemoryBind, DuckDBDatabaseMemoryInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,71 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/common/allocator.hpp"
+
+namespace duckdb {
+
+struct DuckDBHugePagesData : public GlobalTableFunctionState {
+	DuckDBHugePagesData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBHugePagesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("supported");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("enabled");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("huge_page_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("pooled_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("pooled_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("advised_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBHugePagesInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<DuckDBHugePagesData>();
+}
+
+void DuckDBHugePagesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBHugePagesData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto info = Allocator::GetHugePageInformation();
+	// return values:
+	idx_t col = 0;
+	// supported, BOOLEAN
+	output.SetValue(col++, 0, Value::BOOLEAN(Allocator::SupportsHugePages()));
+	// enabled, BOOLEAN
+	output.SetValue(col++, 0, Value::BOOLEAN(info.enabled));
+	// huge_page_size, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(Allocator::HUGE_PAGE_SIZE)));
+	// pooled_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.chunk_memory)));
+	// pooled_usage_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.slot_memory)));
+	// advised_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.advised_memory)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBHugePagesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_huge_pages", {}, DuckDBHugePagesFunction, DuckDBHugePagesBind, DuckDBHugePagesInit));
+}
+
+} // namespace duckdb
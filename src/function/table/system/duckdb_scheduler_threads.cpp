@@ -0,0 +1,75 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBSchedulerThreadsData : public GlobalTableFunctionState {
+	DuckDBSchedulerThreadsData() : offset(0) {
+	}
+
+	vector<SchedulerThreadInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBSchedulerThreadsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("thread_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("tasks_executed");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("tasks_blocked");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("idle_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("failed_dequeues");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBSchedulerThreadsInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBSchedulerThreadsData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetThreadInformation();
+	return std::move(result);
+}
+
+void DuckDBSchedulerThreadsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBSchedulerThreadsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// thread_id, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.thread_id)));
+		// tasks_executed, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.tasks_executed)));
+		// tasks_blocked, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.tasks_blocked)));
+		// idle_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.idle_count)));
+		// failed_dequeues, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.failed_dequeues)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBSchedulerThreadsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_scheduler_threads", {}, DuckDBSchedulerThreadsFunction,
+	                              DuckDBSchedulerThreadsBind, DuckDBSchedulerThreadsInit));
+}
+
+} // namespace duckdb
@@ -25,6 +25,17 @@ struct AllocatorDebugInfo;
 
 enum class AllocatorFreeType { REQUIRES_FREE, DOES_NOT_REQUIRE_FREE };
 
+struct HugePageInformation {
+	//! Whether or not new allocations are backed by huge pages
+	bool enabled = false;
+	//! The size of the huge-page aligned chunks from which smaller allocations are served
+	idx_t chunk_memory = 0;
+	//! The part of the chunks that is in use
+	idx_t slot_memory = 0;
+	//! The part of large allocations that is advised to be backed by huge pages
+	idx_t advised_memory = 0;
+};
+
 struct PrivateAllocatorData {
 	PrivateAllocatorData();
 	virtual ~PrivateAllocatorData();
@@ -86,6 +97,9 @@ class Allocator {
 	static constexpr const idx_t MAXIMUM_ALLOC_SIZE = 281474976710656ULL;
 
 public:
+	//! The size of a (transparent) huge page
+	static constexpr const idx_t HUGE_PAGE_SIZE = 2097152ULL;
+
 	DUCKDB_API Allocator();
 	DUCKDB_API Allocator(allocate_function_ptr_t allocate_function_p, free_function_ptr_t free_function_p,
 	                     reallocate_function_ptr_t reallocate_function_p,
@@ -122,6 +136,12 @@ public:
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
 
+	//! Whether or not allocations can be backed by huge pages on this platform
+	static bool SupportsHugePages();
+	//! Back allocations of the default allocator with huge pages (process-wide)
+	static void SetHugePages(bool enable);
+	static HugePageInformation GetHugePageInformation();
+
 private:
 	allocate_function_ptr_t allocate_function;
 	free_function_ptr_t free_function;
@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/thread_pin_mode.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! How the background threads of the TaskScheduler are pinned to CPUs
+//! OFF: threads are not pinned
+//! AUTO: threads are pinned to the CPUs of a NUMA node if the system has multiple NUMA nodes
+//! ON: every thread is pinned to a single CPU, spread over the NUMA nodes
+enum class ThreadPinMode : uint8_t { OFF = 0, AUTO = 1, ON = 2 };
+
+} // namespace duckdb
@@ -68,6 +68,7 @@ public:
 	DUCKDB_API void Truncate(int64_t new_size);
 	DUCKDB_API string ReadLine();
 	DUCKDB_API bool Trim(idx_t offset_bytes, idx_t length_bytes);
+	DUCKDB_API bool ReadAhead(idx_t location, idx_t nr_bytes);
 	DUCKDB_API virtual idx_t GetProgress();
 	DUCKDB_API virtual FileCompressionType GetFileCompressionType();
 
@@ -126,6 +127,14 @@ public:
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
+	//! Hint that the given range of the file will be read soon. The file-system is free to start loading the range
+	//! asynchronously, so that subsequent reads do not block on IO. Returns false if the hint was not used.
+	DUCKDB_API virtual bool ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes);
+	//! Map the first nr_bytes of the file into memory. Pages are shared with the page cache of the OS until they are
+	//! written to, writes are private to the mapping. Returns nullptr if the file cannot be mapped.
+	DUCKDB_API virtual data_ptr_t MapFile(FileHandle &handle, idx_t nr_bytes);
+	//! Unmap a mapping that was created with MapFile
+	DUCKDB_API virtual void UnmapFile(FileHandle &handle, data_ptr_t mapping, idx_t nr_bytes);
 
 	//! Returns the file size of a file handle, returns -1 on error
 	DUCKDB_API virtual int64_t GetFileSize(FileHandle &handle);
@@ -33,6 +33,13 @@ public:
 	//! range (sparse file support). Reads to the range will succeed but will return
 	//! undefined data.
 	bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) override;
+	//! Hint that the given range of the file will be read soon - the OS starts reading it into the page cache
+	//! asynchronously
+	bool ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) override;
+	//! Map the first nr_bytes of the file into memory (copy-on-write)
+	data_ptr_t MapFile(FileHandle &handle, idx_t nr_bytes) override;
+	//! Unmap a mapping that was created with MapFile
+	void UnmapFile(FileHandle &handle, data_ptr_t mapping, idx_t nr_bytes) override;
 
 	//! Returns the file size of a file handle, returns -1 on error
 	int64_t GetFileSize(FileHandle &handle) override;
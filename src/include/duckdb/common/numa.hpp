@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/thread_pin_mode.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class FileSystem;
+
+//! The NUMA topology of the system, i.e., the CPUs that belong to each NUMA node
+class NUMATopology {
+public:
+	//! Detect the NUMA topology of the system - on Linux this reads /sys/devices/system/node
+	//! If the topology cannot be detected, the topology has no nodes
+	static NUMATopology Detect(FileSystem &fs);
+	//! Parse a list of CPUs in the format of /sys/devices/system/node/nodeN/cpulist (e.g., "0-3,8-11")
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+
+	//! The number of NUMA nodes
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+	//! The CPUs of the given NUMA node
+	const vector<idx_t> &GetNodeCPUs(idx_t node) const {
+		return node_cpus[node];
+	}
+	//! Returns the CPUs the thread with the given index should be pinned to - threads are assigned to the NUMA nodes in
+	//! a round-robin fashion. Returns an empty list if the thread should not be pinned.
+	vector<idx_t> GetThreadCPUs(ThreadPinMode mode, idx_t thread_idx) const;
+	//! Returns all CPUs of all NUMA nodes
+	vector<idx_t> GetAllCPUs() const;
+
+private:
+	//! The CPUs of each NUMA node
+	vector<vector<idx_t>> node_cpus;
+};
+
+} // namespace duckdb
@@ -136,6 +136,8 @@ public:
 	//! The VectorCache is used so this can be done without requiring any allocations.
 	DUCKDB_API void ResetFromCache(const VectorCache &cache);
 
+	//! Turns this vector into a dictionary vector that references all (dictionary_size) entries of the dictionary
+	DUCKDB_API void Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count);
 	//! Creates a reference to a slice of the other vector
 	DUCKDB_API void Slice(const Vector &other, idx_t offset, idx_t end);
 	//! Creates a reference to a slice of the other vector
@@ -320,6 +322,21 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The size of the dictionary - only known if the child holds the full dictionary (e.g. when created through
+	//! Vector::Dictionary), in which case operators can process the dictionary entries instead of the rows
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
+	//! An identifier that is stable across vectors referencing the same dictionary (empty if unknown)
+	static inline const string &DictionaryId(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionaryId();
+	}
+	static inline void SetDictionaryId(Vector &vector, string id) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		vector.buffer->Cast<DictionaryBuffer>().SetDictionaryId(std::move(id));
+	}
 };
 
 struct FlatVector {
@@ -12,6 +12,7 @@
 #include "duckdb/common/enums/pending_execution_result.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
+#include "duckdb/common/queue.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/parallel/pipeline.hpp"
@@ -81,6 +82,12 @@ public:
 	//! Add the task to be rescheduled
 	void AddToBeRescheduled(shared_ptr<Task> &task);
 
+	//! Schedules the tasks of an event - if the connection limits the threads of a query (query_max_threads), tasks
+	//! beyond the limit are held back until earlier tasks of the query have finished
+	void ScheduleEventTasks(vector<shared_ptr<Task>> &tasks);
+	//! Signals that a task of an event has finished, and schedules the next held back task (if any)
+	void FinishEventTask();
+
 	//! Returns the progress of the pipelines
 	bool GetPipelinesProgress(double &current_progress, uint64_t &current_cardinality, uint64_t &total_cardinality);
 
@@ -184,5 +191,14 @@ private:
 
 	//! Currently alive executor tasks
 	atomic<idx_t> executor_tasks;
+
+	//! The maximum number of event tasks that are scheduled at the same time (0 = no limit)
+	idx_t max_scheduled_tasks;
+	//! The number of event tasks that are currently scheduled or running
+	idx_t scheduled_tasks;
+	//! Event tasks that are held back until one of the scheduled tasks has finished
+	queue<shared_ptr<Task>> held_back_tasks;
+	//! Lock for the scheduled and held back tasks
+	mutex held_back_lock;
 };
 } // namespace duckdb
@@ -65,6 +65,10 @@ struct DuckDBDatabasesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBDatabaseMemoryFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBDependenciesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -77,6 +81,10 @@ struct DuckDBFunctionsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBHugePagesFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBKeywordsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -97,6 +105,10 @@ struct DuckDBSequencesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBSchedulerThreadsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSettingsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
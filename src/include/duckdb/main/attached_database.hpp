@@ -43,6 +43,8 @@ struct AttachOptions {
 	AccessMode access_mode;
 	//! The file format type. The default type is a duckdb database file, but other file formats are possible.
 	string db_type;
+	//! The amount of memory that is reserved for the blocks of the database in the buffer pool
+	idx_t memory_reservation = 0;
 	//! We only set this, if we detect any unrecognized option.
 	string unrecognized_option;
 };
@@ -100,6 +102,8 @@ private:
 	optional_ptr<StorageExtension> storage_extension;
 	bool is_initial_database = false;
 	bool is_closed = false;
+	//! The amount of memory that is reserved for the blocks of the database in the buffer pool
+	idx_t memory_reservation = 0;
 };
 
 } // namespace duckdb
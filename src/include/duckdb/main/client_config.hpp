@@ -104,6 +104,11 @@ struct ClientConfig {
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! The maximum amount of memory that the operators of a single query of this connection may reserve
+	//! INVALID_INDEX means the query may use as much memory as the database allows
+	idx_t query_max_memory = DConstants::INVALID_INDEX;
+	//! The maximum number of threads that a single query of this connection may use (0 = no limit)
+	idx_t query_max_threads = 0;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
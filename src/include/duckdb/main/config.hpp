@@ -18,6 +18,7 @@
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/enums/set_scope.hpp"
+#include "duckdb/common/enums/thread_pin_mode.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/set.hpp"
@@ -58,7 +59,8 @@ enum class CheckpointAbort : uint8_t {
 	NO_ABORT = 0,
 	DEBUG_ABORT_BEFORE_TRUNCATE = 1,
 	DEBUG_ABORT_BEFORE_HEADER = 2,
-	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
+	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3,
+	DEBUG_ABORT_IN_ROW_GROUP_WRITE = 4
 };
 
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
@@ -124,8 +126,14 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether or not automatic checkpoints are performed by a background thread instead of the committing thread
+	bool background_checkpoint = false;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! Whether or not read-only database files are memory-mapped instead of read into the buffer pool
+	bool use_mmap = false;
+	//! Whether or not the loaded blocks of a database are recorded at checkpoints and loaded again when it is attached
+	bool buffer_pool_warmup = false;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
 #ifdef DUCKDB_EXTENSION_AUTOLOAD_DEFAULT
@@ -157,6 +165,8 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not blocks that are written to the temporary directory are compressed
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -237,6 +247,10 @@ struct DBConfigOptions {
 	idx_t allocator_flush_threshold = 134217728;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Whether buffer-pool blocks and large allocations are backed by transparent huge pages
+	bool allocator_huge_pages = false;
+	//! How the background threads are pinned to CPUs
+	ThreadPinMode pin_threads = ThreadPinMode::OFF;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
@@ -11,6 +11,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -24,6 +25,20 @@ class TaskScheduler;
 
 struct SchedulerThread;
 
+//! Statistics of a background thread of the TaskScheduler
+struct SchedulerThreadInformation {
+	//! The index of the background thread
+	idx_t thread_id;
+	//! The amount of tasks the thread has executed
+	idx_t tasks_executed;
+	//! The amount of executed tasks that were blocked and descheduled
+	idx_t tasks_blocked;
+	//! The amount of times the thread went idle because there were no tasks available
+	idx_t idle_count;
+	//! The amount of times the thread was woken up for a task, but another thread took the task first
+	idx_t failed_dequeues;
+};
+
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
 	~ProducerToken();
@@ -51,7 +66,8 @@ public:
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
-	void ExecuteForever(atomic<bool> *marker);
+	//! If "thread" is set, the statistics of the thread are updated while executing tasks
+	void ExecuteForever(atomic<bool> *marker, SchedulerThread *thread = nullptr);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -67,6 +83,8 @@ public:
 
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
+	//! Returns the statistics of the background threads
+	vector<SchedulerThreadInformation> GetThreadInformation();
 
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
@@ -78,6 +96,8 @@ public:
 	void SetAllocatorFlushTreshold(idx_t threshold);
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
+	//! Sets how the background threads are pinned to CPUs, and re-pins the running background threads
+	void SetThreadPinMode(ThreadPinMode mode);
 
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
@@ -86,6 +106,8 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Pins the background thread with the given index according to the thread pin mode
+	void PinThread(idx_t thread_idx);
 
 private:
 	DatabaseInstance &db;
@@ -105,6 +127,10 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! The NUMA topology of the system
+	NUMATopology numa_topology;
+	//! How the background threads are pinned to CPUs (protected by thread_lock)
+	ThreadPinMode thread_pin_mode;
 };
 
 } // namespace duckdb
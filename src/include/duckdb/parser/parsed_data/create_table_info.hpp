@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The column the data of the table is kept (approximately) sorted on - empty if the table is not clustered
+	string cluster_by;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
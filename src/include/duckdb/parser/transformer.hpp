@@ -283,6 +283,8 @@ private:
 	string TransformCollation(optional_ptr<duckdb_libpgquery::PGCollateClause> collate);
 
 	ColumnDefinition TransformColumnDefinition(duckdb_libpgquery::PGColumnDef &cdef);
+	//! Transform the cluster_by option of CREATE TABLE into a column name
+	string TransformClusterBy(optional_ptr<duckdb_libpgquery::PGNode> arg);
 	//===--------------------------------------------------------------------===//
 	// Helpers
 	//===--------------------------------------------------------------------===//
@@ -26,6 +26,13 @@ public:
 	block_id_t id;
 };
 
+//! A MappedBlock points directly into a memory mapping of the database file - it does not own its memory
+class MappedBlock : public Block {
+public:
+	MappedBlock(Allocator &allocator, block_id_t id, data_ptr_t mapped_buffer, idx_t alloc_size);
+	~MappedBlock() override;
+};
+
 struct BlockPointer {
 	BlockPointer(block_id_t block_id_p, uint32_t offset_p) : block_id(block_id_p), offset(offset_p) {
 	}
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/optional_idx.hpp"
@@ -25,6 +26,8 @@ class MetadataManager;
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
+	friend class BlockHandle;
+
 public:
 	BlockManager() = delete;
 	BlockManager(BufferManager &buffer_manager, const optional_idx block_alloc_size_p);
@@ -58,6 +61,15 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Hint that a range of blocks will be read soon - this does not load the blocks into memory
+	virtual void ReadAhead(block_id_t start_block, idx_t block_count);
+	//! Whether or not blocks are accessed directly through a memory mapping of the file, instead of being read into
+	//! buffers that are managed by the buffer pool
+	virtual bool IsMemoryMapped() {
+		return false;
+	}
+	//! Returns a block that points directly into the memory mapping of the file
+	virtual unique_ptr<Block> ReadMappedBlock(block_id_t block_id);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -87,6 +99,9 @@ public:
 	shared_ptr<BlockHandle> ConvertToPersistent(block_id_t block_id, shared_ptr<BlockHandle> old_block);
 
 	void UnregisterBlock(block_id_t block_id, bool can_destroy);
+	//! Returns the ids of the registered blocks that are currently loaded in memory
+	//! Blocks that were re-used since they were loaded are returned first, followed by the remaining blocks
+	vector<block_id_t> GetLoadedBlocks();
 
 	//! Returns a reference to the metadata manager of this block manager.
 	MetadataManager &GetMetadataManager();
@@ -102,6 +117,23 @@ public:
 	inline idx_t GetBlockSize() const {
 		return block_alloc_size.GetIndex() - Storage::DEFAULT_BLOCK_HEADER_SIZE;
 	}
+	//! Returns the amount of memory that is used by the loaded blocks of this block manager
+	idx_t GetMemoryUsage() const {
+		return memory_usage;
+	}
+	//! Returns the amount of memory that is reserved for the blocks of this block manager
+	idx_t GetMemoryReservation() const {
+		return memory_reservation;
+	}
+	//! Reserve memory for the blocks of this block manager: as long as the loaded blocks use less memory than the
+	//! reservation, they are not evicted to make room for the blocks of other databases
+	void SetMemoryReservation(idx_t reservation) {
+		memory_reservation = reservation;
+	}
+	//! Whether or not the loaded blocks use less memory than the reservation
+	bool IsWithinMemoryReservation() const {
+		return memory_usage < memory_reservation;
+	}
 	//! Sets the block allocation size. This should only happen when initializing an existing database.
 	//! When initializing an existing database, we construct the block manager before reading the file header,
 	//! which contains the file's actual block allocation size.
@@ -112,6 +144,13 @@ public:
 		block_alloc_size = block_alloc_size_p.GetIndex();
 	}
 
+public:
+	template <class TARGET>
+	TARGET &Cast() {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<TARGET &>(*this);
+	}
+
 private:
 	//! The lock for the set of blocks
 	mutex blocks_lock;
@@ -123,5 +162,9 @@ private:
 	//! for in-memory block managers. Default to default_block_alloc_size for file-backed block managers.
 	//! This is NOT the actual memory available on a block (block_size).
 	optional_idx block_alloc_size;
+	//! The amount of memory that is used by the loaded blocks of this block manager
+	atomic<idx_t> memory_usage;
+	//! The amount of memory that is reserved for the blocks of this block manager
+	atomic<idx_t> memory_reservation;
 };
 } // namespace duckdb
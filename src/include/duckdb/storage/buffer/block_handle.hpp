@@ -12,6 +12,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/storage/storage_info.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
@@ -28,6 +29,8 @@ struct BufferPoolReservation {
 	MemoryTag tag;
 	idx_t size {0};
 	BufferPool &pool;
+	//! The memory usage of the database that the reserved memory belongs to (if any)
+	optional_ptr<atomic<idx_t>> database_memory;
 
 	BufferPoolReservation(MemoryTag tag, BufferPool &pool);
 	BufferPoolReservation(const BufferPoolReservation &) = delete;
@@ -112,6 +115,9 @@ private:
 	unique_ptr<FileBuffer> UnloadAndTakeBlock();
 	void Unload();
 	bool CanUnload();
+	//! Whether or not the block points directly into a memory mapping of the database file
+	//! Such blocks are not charged to the buffer pool, and are never evicted
+	bool IsMemoryMapped() const;
 
 	//! The block-level lock
 	mutex lock;
@@ -129,6 +135,12 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! Whether or not the (persistent) block was re-used since it was loaded, in which case it is in the eviction queue
+	//! for frequently used blocks
+	bool frequently_used;
+	//! The amount of insertions into the eviction queue when the block was last added to it after being loaded
+	//! (INVALID_INDEX if it was not added to the eviction queue since it was loaded)
+	idx_t eviction_queue_insertion;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
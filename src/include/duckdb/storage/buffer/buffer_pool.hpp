@@ -34,6 +34,9 @@ struct BufferEvictionNode {
 
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
+//! Persistent blocks are kept in two eviction queues (similar to 2Q): blocks enter the first queue when they are
+//! loaded, and move to the queue of frequently used blocks when they are re-used after a while. Blocks that are only
+//! used once (e.g., by a large table scan) are evicted first, so that they do not push out the frequently used blocks.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
@@ -84,8 +87,14 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the eviction queue that holds the latest node of the block handle
+	EvictionQueue &GetEvictionQueueForBlockHandle(const BlockHandle &handle);
+	//! Gets the eviction queue for frequently used persistent blocks
+	EvictionQueue &GetFrequentlyUsedEvictionQueue();
+	//! Increments the dead nodes for the queue that holds the latest node of the block handle
+	void IncrementDeadNodes(const BlockHandle &handle);
+	//! Removes a block that is unloaded or destroyed from the frequently used blocks (if it was frequently used)
+	void RemoveFrequentlyUsed(BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -137,8 +146,10 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues - one per FileBufferType, followed by the queue for frequently used persistent blocks
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The memory used by blocks in the eviction queue for frequently used blocks
+	atomic<idx_t> frequently_used_memory;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
@@ -41,6 +41,8 @@ public:
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	//! Prefetch a series of blocks. Note that this is a performance suggestion.
 	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles) = 0;
+	//! Hint that a series of blocks will be read soon. Unlike Prefetch, the blocks are not loaded into memory.
+	virtual void ReadAhead(vector<shared_ptr<BlockHandle>> &handles);
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
 
 	//! Returns the currently allocated memory
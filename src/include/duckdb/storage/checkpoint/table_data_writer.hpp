@@ -8,11 +8,13 @@
 
 #pragma once
 
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/storage/checkpoint/row_group_writer.hpp"
 
 namespace duckdb {
 class DuckTableEntry;
 class TableStatistics;
+struct CollectionCheckpointState;
 
 //! The table data writer is responsible for writing the data of a table to
 //! storage.
@@ -27,9 +29,18 @@ public:
 	virtual ~TableDataWriter();
 
 public:
+	//! Schedule the compression and writing of the row groups of the table, without waiting for it to finish
+	void ScheduleTableData();
+	//! The amount of row groups that have been scheduled by ScheduleTableData
+	idx_t GetScheduledRowGroupCount() const;
+	//! Wait for the scheduled row group writes (if any) to finish - this must be called before the writer is destroyed,
+	//! as the scheduled tasks call into the writer
+	void FinishScheduledTasks();
 	void WriteTableData(Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	//! The storage index of the column the table is clustered by (if any)
+	optional_idx GetClusterColumn();
 
 	virtual void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) = 0;
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) = 0;
@@ -43,6 +54,8 @@ protected:
 	DuckTableEntry &table;
 	//! Pointers to the start of each row group.
 	vector<RowGroupPointer> row_group_pointers;
+	//! The state of the scheduled row group writes (if any)
+	unique_ptr<CollectionCheckpointState> checkpoint_state;
 };
 
 class SingleFileTableDataWriter : public TableDataWriter {
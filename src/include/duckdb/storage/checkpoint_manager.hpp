@@ -11,6 +11,8 @@
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -92,12 +94,31 @@ public:
 class SingleFileRowGroupWriter;
 class SingleFileTableDataWriter;
 
+//! The data of a table that is being written as part of a checkpoint
+struct CheckpointTableData {
+	explicit CheckpointTableData(TableCatalogEntry &table);
+	CheckpointTableData(CheckpointTableData &&other) noexcept;
+	~CheckpointTableData();
+
+	reference<TableCatalogEntry> table;
+	//! The checkpoint lock of the table - held until the table has been fully written
+	unique_ptr<StorageLockKey> checkpoint_lock;
+	//! The writer of the table data
+	unique_ptr<TableDataWriter> writer;
+	//! The amount of row groups that were scheduled for writing
+	idx_t row_group_count = 0;
+};
+
 class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileRowGroupWriter;
 	friend class SingleFileTableDataWriter;
 
+	//! The maximum amount of row groups per thread that are written ahead of the table that is being serialized
+	static constexpr const idx_t CHECKPOINT_ROW_GROUPS_PER_THREAD = 4;
+
 public:
 	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type);
+	~SingleFileCheckpointWriter() override;
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
@@ -115,6 +136,13 @@ public:
 public:
 	void WriteTable(TableCatalogEntry &table, Serializer &serializer) override;
 
+private:
+	//! Schedule the row group writes of upcoming tables, so that they are compressed in parallel with the table that
+	//! is currently being written
+	void ScheduleTables();
+	//! Obtain the (possibly already scheduled) data of the table that is serialized next
+	CheckpointTableData GetTableData(TableCatalogEntry &table);
+
 private:
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
@@ -125,6 +153,14 @@ private:
 	PartialBlockManager partial_block_manager;
 	//! Checkpoint type
 	CheckpointType checkpoint_type;
+	//! The tables of the checkpoint, in the order in which they are serialized
+	vector<reference<TableCatalogEntry>> tables;
+	//! The index of the next table in "tables" that can be scheduled
+	idx_t next_table_idx = 0;
+	//! The tables whose row groups are being written ahead of their serialization
+	deque<CheckpointTableData> scheduled_tables;
+	//! The amount of row groups of the tables in "scheduled_tables"
+	idx_t scheduled_row_groups = 0;
 };
 
 } // namespace duckdb
@@ -39,6 +39,7 @@ class TableIOManager;
 class Transaction;
 class WriteAheadLog;
 class TableDataWriter;
+struct CollectionCheckpointState;
 class ConflictManager;
 class TableScanState;
 struct TableDeleteState;
@@ -187,8 +188,12 @@ public:
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
 	//! Obtains a lock during a checkpoint operation that prevents other threads from reading this table
 	unique_ptr<StorageLockKey> GetCheckpointLock();
+	//! Try to obtain the checkpoint lock - returns nullptr if it cannot be obtained immediately
+	unique_ptr<StorageLockKey> TryGetCheckpointLock();
+	//! Schedule the row group writes of a checkpoint of the table to the specified table data writer
+	unique_ptr<CollectionCheckpointState> ScheduleCheckpoint(TableDataWriter &writer);
 	//! Checkpoint the table to the specified table data writer
-	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
+	void Checkpoint(TableDataWriter &writer, CollectionCheckpointState &checkpoint_state, Serializer &serializer);
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
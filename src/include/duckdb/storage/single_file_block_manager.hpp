@@ -21,10 +21,13 @@ namespace duckdb {
 
 class DatabaseInstance;
 struct MetadataHandle;
+struct BufferPoolWarmupState;
 
 struct StorageManagerOptions {
 	bool read_only = false;
 	bool use_direct_io = false;
+	//! Whether or not the file is memory-mapped (only for read-only databases)
+	bool use_mmap = false;
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 	optional_idx block_alloc_size = optional_idx();
 };
@@ -36,6 +39,7 @@ class SingleFileBlockManager : public BlockManager {
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db, const string &path, const StorageManagerOptions &options);
+	~SingleFileBlockManager() override;
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	//! Creates a new database.
@@ -67,6 +71,14 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Hint to the file system that a range of blocks will be read soon
+	void ReadAhead(block_id_t start_block, idx_t block_count) override;
+	//! Whether or not the blocks of the file are accessed through a memory mapping
+	bool IsMemoryMapped() override {
+		return mapped_file != nullptr;
+	}
+	//! Returns a block that points into the memory mapping of the file
+	unique_ptr<Block> ReadMappedBlock(block_id_t block_id) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -84,6 +96,13 @@ public:
 	//! Whether or not the attached database is a remote file
 	bool IsRemote() override;
 
+	//! Record the blocks that are currently loaded in memory in the warmup file of the database
+	void WriteWarmupFile();
+	//! Schedule a background task that loads the blocks recorded in the warmup file (if any)
+	void StartWarmup();
+	//! Load a batch of blocks recorded in the warmup file - returns false if the warmup should be stopped
+	bool WarmupBlocks(const vector<block_id_t> &block_ids);
+
 private:
 	//! Loads the free list of the file.
 	void LoadFreeList();
@@ -92,6 +111,8 @@ private:
 	void Initialize(const DatabaseHeader &header, const optional_idx block_alloc_size);
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
+	//! Memory-map the file, if enabled and supported by the file system
+	void MapFile();
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
 
 	idx_t GetBlockLocation(block_id_t block_id);
@@ -102,6 +123,11 @@ private:
 
 	void IncreaseBlockReferenceCountInternal(block_id_t block_id);
 
+	//! Returns the path of the file in which the loaded blocks are recorded
+	string GetWarmupPath() const;
+	//! Stop the warmup task and release the blocks it has loaded
+	void StopWarmup();
+
 private:
 	AttachedDatabase &db;
 	//! The active DatabaseHeader, either 0 (h1) or 1 (h2)
@@ -134,5 +160,13 @@ private:
 	StorageManagerOptions options;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+	//! The memory mapping of the file (if any)
+	data_ptr_t mapped_file = nullptr;
+	//! The size of the memory mapping
+	idx_t mapped_size = 0;
+	//! The state of the warmup task (if any)
+	shared_ptr<BufferPoolWarmupState> warmup;
+	//! The blocks loaded by the warmup task - these are kept alive until the next checkpoint
+	vector<shared_ptr<BlockHandle>> warmup_blocks;
 };
 } // namespace duckdb
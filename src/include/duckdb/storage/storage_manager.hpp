@@ -46,12 +46,14 @@ public:
 struct CheckpointOptions {
 	CheckpointOptions()
 	    : wal_action(CheckpointWALAction::DONT_DELETE_WAL), action(CheckpointAction::CHECKPOINT_IF_REQUIRED),
-	      type(CheckpointType::FULL_CHECKPOINT) {
+	      type(CheckpointType::FULL_CHECKPOINT), automatic(false) {
 	}
 
 	CheckpointWALAction wal_action;
 	CheckpointAction action;
 	CheckpointType type;
+	//! Whether the checkpoint was triggered automatically because the WAL grew too large
+	bool automatic;
 };
 
 //! StorageManager is responsible for managing the physical storage of the
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/table/collection_checkpoint_state.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/storage/checkpoint/row_group_writer.hpp"
+#include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/segment_lock.hpp"
+#include "duckdb/storage/table/segment_tree.hpp"
+#include "duckdb/storage/table/table_statistics.hpp"
+
+namespace duckdb {
+class RowGroupCollection;
+class TableDataWriter;
+struct VacuumState;
+
+//! The state of a (possibly still running) checkpoint of a RowGroupCollection
+//! The row groups are compressed and written by tasks scheduled on the TaskScheduler, after which they are finalized
+//! (i.e. their metadata is written) in order by RowGroupCollection::Checkpoint
+struct CollectionCheckpointState {
+	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
+	                          vector<SegmentNode<RowGroup>> segments, SegmentLock l);
+	~CollectionCheckpointState();
+
+	RowGroupCollection &collection;
+	TableDataWriter &writer;
+	TaskExecutor executor;
+	vector<SegmentNode<RowGroup>> segments;
+	vector<unique_ptr<RowGroupWriter>> writers;
+	vector<RowGroupWriteData> write_data;
+	TableStatistics global_stats;
+	//! The state used to decide which row groups are vacuumed - referenced by the scheduled vacuum tasks
+	unique_ptr<VacuumState> vacuum_state;
+	//! Lock on the segment tree of the collection - held until the checkpoint is finalized
+	SegmentLock l;
+	//! Whether or not the scheduled tasks have been waited on
+	bool finished = false;
+
+public:
+	//! Wait for all scheduled tasks to finish - throws if any of the tasks encountered an error
+	void WorkOnTasks();
+};
+
+} // namespace duckdb
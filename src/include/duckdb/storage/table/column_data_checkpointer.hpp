@@ -16,6 +16,9 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+	//! Unchanged segments with fewer rows than this are rewritten if they are adjacent to changed segments
+	static constexpr const idx_t MINIMUM_REUSED_SEGMENT_COUNT = STANDARD_VECTOR_SIZE * 8;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -25,6 +28,8 @@ public:
 	const LogicalType &GetType() const;
 	ColumnData &GetColumnData();
 	RowGroup &GetRowGroup();
+	//! The row at which the segments that are currently being written start
+	idx_t GetRowStart() const;
 	ColumnCheckpointState &GetCheckpointState();
 
 	void Checkpoint(vector<SegmentNode<ColumnSegment>> nodes);
@@ -34,7 +39,7 @@ private:
 	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
-	bool HasChanges();
+	bool HasChanges(ColumnSegment &segment);
 	void WritePersistentSegments();
 
 private:
@@ -46,6 +51,7 @@ private:
 	vector<SegmentNode<ColumnSegment>> nodes;
 	vector<optional_ptr<CompressionFunction>> compression_functions;
 	ColumnCheckpointInfo &checkpoint_info;
+	idx_t row_start;
 };
 
 } // namespace duckdb
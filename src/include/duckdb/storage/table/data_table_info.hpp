@@ -29,6 +29,13 @@ public:
 
 	//! Whether or not the table is temporary
 	bool IsTemporary() const;
+	//! Whether or not the table is clustered, i.e. its data is sorted on a column when it is checkpointed
+	bool IsClustered() const {
+		return is_clustered;
+	}
+	void SetClustered(bool clustered) {
+		is_clustered = clustered;
+	}
 
 	AttachedDatabase &GetDB() {
 		return db;
@@ -66,6 +73,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! Whether or not the table is clustered
+	atomic<bool> is_clustered {false};
 };
 
 } // namespace duckdb
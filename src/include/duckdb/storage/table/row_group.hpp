@@ -190,6 +190,8 @@ private:
 
 	template <TableScanType TYPE>
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
+	//! Hint to the file system that the blocks of the scanned columns will be read soon
+	void ReadAhead(CollectionScanState &state, idx_t row_count);
 
 	vector<MetaBlockPointer> CheckpointDeletes(MetadataManager &manager);
 
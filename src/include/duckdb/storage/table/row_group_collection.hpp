@@ -94,11 +94,15 @@ public:
 	void UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
 	                  DataChunk &updates);
 
-	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Schedule the tasks that compress and write the row groups of the collection, without waiting for them
+	unique_ptr<CollectionCheckpointState> ScheduleCheckpoint(TableDataWriter &writer);
+	//! Wait for the scheduled row group writes and write the row group metadata in order
+	void Checkpoint(CollectionCheckpointState &checkpoint_state);
 
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
+	bool ScheduleClusterTask(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
 	void ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
 
 	void CommitDropColumn(idx_t index);
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -45,6 +45,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size on disk of each block index
+	idx_t block_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -75,7 +77,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +90,16 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Write a buffer to the given index - if this file holds compressed blocks the compressed buffer is written
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	//! The size of the slots in this file
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -101,6 +108,8 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	//! The size of the slots in this file - smaller than the block allocation size if the file holds compressed blocks
+	const idx_t slot_size;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
@@ -132,6 +141,12 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed blocks are written to slots that are a multiple of this size
+	static constexpr idx_t COMPRESSED_SLOT_ALIGNMENT = 32768;
+	//! The maximum amount of buffers we skip compressing after buffers have not compressed well
+	static constexpr idx_t MAX_COMPRESSION_BACKOFF = 64;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -159,6 +174,9 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Compress the buffer into the compressed buffer (if enabled and worthwhile)
+	//! Returns the slot size the buffer should be written to - equal to the block allocation size if not compressed
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -180,6 +198,10 @@ private:
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
 	idx_t max_swap_space;
+	//! The amount of consecutive buffers that did not compress well enough to be stored in a smaller slot
+	atomic<idx_t> incompressible_count;
+	//! The amount of buffers that were not compressed because of the incompressible_count
+	atomic<idx_t> skipped_compression_count;
 };
 
 } // namespace duckdb
@@ -14,6 +14,7 @@
 
 namespace duckdb {
 class DuckTransaction;
+struct BackgroundCheckpointState;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -33,6 +34,10 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Perform an automatic checkpoint - called from a background task scheduled by a committing transaction
+	void BackgroundCheckpoint();
+	//! Wait for a running background checkpoint to finish, and prevent any scheduled ones from running
+	void StopBackgroundCheckpoints();
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -67,6 +72,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the checkpoint should instead be performed by a background task after the commit has finished
+		bool in_background = false;
 	};
 
 private:
@@ -80,6 +87,10 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Whether or not automatic checkpoints should be performed by a background task
+	bool CheckpointInBackground();
+	//! Schedule a background task that performs an automatic checkpoint (if none is scheduled yet)
+	void ScheduleBackgroundCheckpoint();
 
 private:
 	//! The current start timestamp used by transactions
@@ -106,6 +117,8 @@ private:
 	mutex start_transaction_lock;
 	//! Mutex used to control writes to the WAL - separate from the transaction lock
 	mutex wal_lock;
+	//! State shared with scheduled background checkpoint tasks
+	shared_ptr<BackgroundCheckpointState> background_checkpoint;
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
@@ -6,6 +6,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
+#include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/storage_extension.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/duck_transaction_manager.hpp"
@@ -56,6 +57,12 @@ AttachOptions::AttachOptions(const unique_ptr<AttachInfo> &info, const AccessMod
 			continue;
 		}
 
+		if (entry.first == "memory_reservation") {
+			// Extract the memory that is reserved for the blocks of the database.
+			memory_reservation = DBConfig::ParseMemoryLimit(entry.second.ToString());
+			continue;
+		}
+
 		// We allow unrecognized options in storage extensions. To track that we saw an unrecognized option,
 		// we set unrecognized_option.
 		if (unrecognized_option.empty()) {
@@ -99,6 +106,7 @@ AttachedDatabase::AttachedDatabase(DatabaseInstance &db, Catalog &catalog_p, str
 	auto read_only = options.access_mode == AccessMode::READ_ONLY;
 	storage = make_uniq<SingleFileStorageManager>(*this, std::move(file_path_p), read_only);
 	transaction_manager = make_uniq<DuckTransactionManager>(*this);
+	memory_reservation = options.memory_reservation;
 	internal = true;
 }
 
@@ -123,6 +131,7 @@ AttachedDatabase::AttachedDatabase(DatabaseInstance &db, Catalog &catalog_p, Sto
 		// The attached database uses the DuckCatalog.
 		auto read_only = options.access_mode == AccessMode::READ_ONLY;
 		storage = make_uniq<SingleFileStorageManager>(*this, info.path, read_only);
+		memory_reservation = options.memory_reservation;
 	}
 	transaction_manager = storage_extension->create_transaction_manager(storage_info, *this, *catalog);
 	if (!transaction_manager) {
@@ -171,6 +180,7 @@ void AttachedDatabase::Initialize(const optional_idx block_alloc_size) {
 	}
 	if (storage) {
 		storage->Initialize(block_alloc_size);
+		storage->GetBlockManager().SetMemoryReservation(memory_reservation);
 	}
 }
 
@@ -216,6 +226,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// wait for a running background checkpoint - we checkpoint on shutdown instead
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
@@ -7,6 +7,8 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/storage/block_manager.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -35,11 +37,36 @@ optional_ptr<AttachedDatabase> DatabaseManager::GetDatabase(ClientContext &conte
 	return reinterpret_cast<AttachedDatabase *>(databases->GetEntry(context, name).get());
 }
 
+//! Verifies that the memory reservation of a database that is attached fits in the memory limit, together with the
+//! reservations of the databases that are attached already
+static void VerifyMemoryReservation(ClientContext &context, DatabaseManager &manager, const AttachInfo &info,
+                                    idx_t memory_reservation) {
+	auto memory_limit = BufferManager::GetBufferManager(context).GetMaxMemory();
+	idx_t reserved_memory = 0;
+	for (auto &entry : manager.GetDatabases(context)) {
+		auto &attached = entry.get();
+		if (attached.IsSystem() || attached.IsTemporary() || !attached.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		reserved_memory += attached.GetStorageManager().GetBlockManager().GetMemoryReservation();
+	}
+	if (reserved_memory + memory_reservation > memory_limit) {
+		throw InvalidInputException("Cannot attach database \"%s\" with a memory reservation of %s: together with the "
+		                            "reservations of the attached databases (%s) it would exceed the memory limit (%s)",
+		                            info.name, StringUtil::BytesToHumanReadableString(memory_reservation),
+		                            StringUtil::BytesToHumanReadableString(reserved_memory),
+		                            StringUtil::BytesToHumanReadableString(memory_limit));
+	}
+}
+
 optional_ptr<AttachedDatabase> DatabaseManager::AttachDatabase(ClientContext &context, const AttachInfo &info,
                                                                const AttachOptions &options) {
 	if (AttachedDatabase::NameIsReserved(info.name)) {
 		throw BinderException("Attached database name \"%s\" cannot be used because it is a reserved name", info.name);
 	}
+	if (options.memory_reservation > 0) {
+		VerifyMemoryReservation(context, *this, info, options.memory_reservation);
+	}
 	// now create the attached database
 	auto &db = DatabaseInstance::GetDatabase(context);
 	auto attached_db = db.CreateAttachedDatabase(context, info, options);
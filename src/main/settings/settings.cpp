@@ -78,6 +78,38 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = BooleanValue::Get(input);
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Pool Warmup
+//===--------------------------------------------------------------------===//
+void BufferPoolWarmupSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.buffer_pool_warmup = BooleanValue::Get(input);
+}
+
+void BufferPoolWarmupSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_pool_warmup = DBConfig().options.buffer_pool_warmup;
+}
+
+Value BufferPoolWarmupSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.buffer_pool_warmup);
+}
+
 //===--------------------------------------------------------------------===//
 // Access Mode
 //===--------------------------------------------------------------------===//
@@ -124,9 +156,11 @@ void DebugCheckpointAbort::SetGlobal(DatabaseInstance *db, DBConfig &config, con
 		config.options.checkpoint_abort = CheckpointAbort::DEBUG_ABORT_BEFORE_HEADER;
 	} else if (checkpoint_abort == "after_free_list_write") {
 		config.options.checkpoint_abort = CheckpointAbort::DEBUG_ABORT_AFTER_FREE_LIST_WRITE;
+	} else if (checkpoint_abort == "in_row_group_write") {
+		config.options.checkpoint_abort = CheckpointAbort::DEBUG_ABORT_IN_ROW_GROUP_WRITE;
 	} else {
-		throw ParserException(
-		    "Unrecognized option for PRAGMA debug_checkpoint_abort, expected none, before_truncate or before_header");
+		throw ParserException("Unrecognized option for PRAGMA debug_checkpoint_abort, expected none, before_truncate, "
+		                      "before_header, after_free_list_write or in_row_group_write");
 	}
 }
 
@@ -146,6 +180,8 @@ Value DebugCheckpointAbort::GetSetting(const ClientContext &context) {
 		return "before_header";
 	case CheckpointAbort::DEBUG_ABORT_AFTER_FREE_LIST_WRITE:
 		return "after_free_list_write";
+	case CheckpointAbort::DEBUG_ABORT_IN_ROW_GROUP_WRITE:
+		return "in_row_group_write";
 	default:
 		throw InternalException("Type not implemented for CheckpointAbort");
 	}
@@ -1406,6 +1442,47 @@ Value PerfectHashThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).perfect_ht_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "auto") {
+		config.options.pin_threads = ThreadPinMode::AUTO;
+	} else if (parameter == "on") {
+		config.options.pin_threads = ThreadPinMode::ON;
+	} else if (parameter == "off") {
+		config.options.pin_threads = ThreadPinMode::OFF;
+	} else {
+		throw InvalidInputException("Unrecognized parameter for option PIN_THREADS \"%s\". Expected AUTO, ON or OFF.",
+		                            parameter);
+	}
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadPinMode(config.options.pin_threads);
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadPinMode(config.options.pin_threads);
+	}
+}
+
+Value PinThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.pin_threads) {
+	case ThreadPinMode::AUTO:
+		return "auto";
+	case ThreadPinMode::ON:
+		return "on";
+	case ThreadPinMode::OFF:
+		return "off";
+	default:
+		throw InternalException("Unknown thread pin mode setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1591,6 +1668,45 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Max Memory
+//===--------------------------------------------------------------------===//
+void QueryMaxMemorySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_max_memory = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryMaxMemorySetting::ResetLocal(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_max_memory = ClientConfig().query_max_memory;
+}
+
+Value QueryMaxMemorySetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.query_max_memory == DConstants::INVALID_INDEX) {
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_max_memory));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Max Threads
+//===--------------------------------------------------------------------===//
+void QueryMaxThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_max_threads = input.GetValue<idx_t>();
+}
+
+void QueryMaxThreadsSetting::ResetLocal(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_max_threads = ClientConfig().query_max_threads;
+}
+
+Value QueryMaxThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.query_max_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1675,6 +1791,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = BooleanValue::Get(input);
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1703,6 +1835,22 @@ Value ThreadsSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(config.options.maximum_threads));
 }
 
+//===--------------------------------------------------------------------===//
+// Use Mmap
+//===--------------------------------------------------------------------===//
+void UseMmapSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.use_mmap = BooleanValue::Get(input);
+}
+
+void UseMmapSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.use_mmap = DBConfig().options.use_mmap;
+}
+
+Value UseMmapSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_mmap);
+}
+
 //===--------------------------------------------------------------------===//
 // Username Setting
 //===--------------------------------------------------------------------===//
@@ -1762,6 +1910,24 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Allocator Huge Pages
+//===--------------------------------------------------------------------===//
+void AllocatorHugePagesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.allocator_huge_pages = input.GetValue<bool>();
+	Allocator::SetHugePages(config.options.allocator_huge_pages);
+}
+
+void AllocatorHugePagesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.allocator_huge_pages = DBConfig().options.allocator_huge_pages;
+	Allocator::SetHugePages(config.options.allocator_huge_pages);
+}
+
+Value AllocatorHugePagesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.allocator_huge_pages);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
@@ -55,6 +55,7 @@ const vector<reference<Event>> &Event::GetParentsVerification() const {
 
 void Event::FinishTask() {
 	D_ASSERT(finished_tasks.load() < total_tasks.load());
+	executor.FinishEventTask();
 	idx_t current_tasks = total_tasks;
 	idx_t current_finished = ++finished_tasks;
 	D_ASSERT(current_finished <= current_tasks);
@@ -73,13 +74,10 @@ void Event::InsertEvent(shared_ptr<Event> replacement_event) {
 }
 
 void Event::SetTasks(vector<shared_ptr<Task>> tasks) {
-	auto &ts = TaskScheduler::GetScheduler(executor.context);
 	D_ASSERT(total_tasks == 0);
 	D_ASSERT(!tasks.empty());
 	this->total_tasks = tasks.size();
-	for (auto &task : tasks) {
-		ts.ScheduleTask(executor.GetToken(), std::move(task));
-	}
+	executor.ScheduleEventTasks(tasks);
 }
 
 } // namespace duckdb
@@ -22,7 +22,8 @@
 
 namespace duckdb {
 
-Executor::Executor(ClientContext &context) : context(context), executor_tasks(0) {
+Executor::Executor(ClientContext &context)
+    : context(context), executor_tasks(0), max_scheduled_tasks(0), scheduled_tasks(0) {
 }
 
 Executor::~Executor() {
@@ -392,6 +393,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
 		this->producer = scheduler.CreateProducer();
+		this->max_scheduled_tasks = ClientConfig::GetConfig(context).query_max_threads;
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -442,6 +444,11 @@ void Executor::CancelTasks() {
 		to_be_rescheduled_tasks.clear();
 		events.clear();
 	}
+	{
+		// held back tasks are never scheduled
+		lock_guard<mutex> guard(held_back_lock);
+		held_back_tasks = queue<shared_ptr<Task>>();
+	}
 	// Take all pending tasks and execute them until they cancel
 	while (executor_tasks > 0) {
 		WorkOnTasks();
@@ -461,6 +468,45 @@ void Executor::WorkOnTasks() {
 	}
 }
 
+void Executor::ScheduleEventTasks(vector<shared_ptr<Task>> &tasks) {
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (max_scheduled_tasks == 0) {
+		for (auto &task : tasks) {
+			scheduler.ScheduleTask(GetToken(), std::move(task));
+		}
+		return;
+	}
+	lock_guard<mutex> guard(held_back_lock);
+	for (auto &task : tasks) {
+		if (scheduled_tasks >= max_scheduled_tasks) {
+			held_back_tasks.push(std::move(task));
+			continue;
+		}
+		scheduled_tasks++;
+		scheduler.ScheduleTask(GetToken(), std::move(task));
+	}
+}
+
+void Executor::FinishEventTask() {
+	if (max_scheduled_tasks == 0) {
+		return;
+	}
+	shared_ptr<Task> next_task;
+	{
+		lock_guard<mutex> guard(held_back_lock);
+		if (held_back_tasks.empty()) {
+			D_ASSERT(scheduled_tasks > 0);
+			scheduled_tasks--;
+			return;
+		}
+		// the next task takes the place of the finished task
+		next_task = std::move(held_back_tasks.front());
+		held_back_tasks.pop();
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	scheduler.ScheduleTask(GetToken(), std::move(next_task));
+}
+
 void Executor::SignalTaskRescheduled(lock_guard<mutex> &) {
 	task_reschedule.notify_one();
 }
@@ -621,6 +667,11 @@ void Executor::Reset() {
 	pipelines.clear();
 	events.clear();
 	to_be_rescheduled_tasks.clear();
+	{
+		lock_guard<mutex> guard(held_back_lock);
+		held_back_tasks = queue<shared_ptr<Task>>();
+		scheduled_tasks = 0;
+	}
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
 }
 
@@ -114,6 +114,11 @@ bool Pipeline::ScheduleParallel(shared_ptr<Event> &event) {
 	auto max_threads = source_state->MaxThreads();
 	auto &scheduler = TaskScheduler::GetScheduler(executor.context);
 	auto active_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	auto query_max_threads = ClientConfig::GetConfig(executor.context).query_max_threads;
+	if (query_max_threads != 0 && query_max_threads < active_threads) {
+		// the connection limits the number of threads that a single query may occupy
+		active_threads = query_max_threads;
+	}
 	if (max_threads > active_threads) {
 		max_threads = active_threads;
 	}
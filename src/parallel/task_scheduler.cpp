@@ -2,6 +2,7 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/local_file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -23,15 +24,23 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
-#ifndef DUCKDB_NO_THREADS
-	explicit SchedulerThread(unique_ptr<thread> thread_p) : internal_thread(std::move(thread_p)) {
+	SchedulerThread() : tasks_executed(0), tasks_blocked(0), idle_count(0), failed_dequeues(0) {
 	}
 
+#ifndef DUCKDB_NO_THREADS
 	unique_ptr<thread> internal_thread;
 #endif
+	atomic<idx_t> tasks_executed;
+	atomic<idx_t> tasks_blocked;
+	atomic<idx_t> idle_count;
+	atomic<idx_t> failed_dequeues;
 };
 
 #ifndef DUCKDB_NO_THREADS
@@ -121,8 +130,10 @@ TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), thread_pin_mode(db.config.options.pin_threads) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
+	LocalFileSystem fs;
+	numa_topology = NUMATopology::Detect(fs);
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -157,27 +168,37 @@ bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &
 	return queue->DequeueFromProducer(token, task);
 }
 
-void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, SchedulerThread *thread) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	// the consumer token makes the thread keep taking tasks from the same producer (i.e., the same executor) while it
+	// has tasks, and only then move on to the tasks of other producers - this keeps the thread working on the same
+	// data, and spreads the threads over the producers which reduces contention on the queue
+	duckdb_moodycamel::ConsumerToken consumer_token(queue->q);
 	// loop until the marker is set to false
 	while (*marker) {
-		if (!Allocator::SupportsFlush() || allocator_background_threads) {
-			// allocator can't flush, or background threads clean up allocations, just start an untimed wait
-			queue->semaphore.wait();
-		} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
-			// no background threads, flush this threads outstanding allocations after it was idle for 0.5s
-			Allocator::ThreadFlush(allocator_flush_threshold);
-			if (!queue->semaphore.wait(Allocator::DecayDelay() * 1000000 - INITIAL_FLUSH_WAIT)) {
-				// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
-				// mark it as idle and start an untimed wait
-				Allocator::ThreadIdle();
+		if (!queue->semaphore.tryWait()) {
+			// there are no tasks available - the thread goes idle until it is signaled
+			if (thread) {
+				thread->idle_count++;
+			}
+			if (!Allocator::SupportsFlush() || allocator_background_threads) {
+				// allocator can't flush, or background threads clean up allocations, just start an untimed wait
 				queue->semaphore.wait();
+			} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
+				// no background threads, flush this threads outstanding allocations after it was idle for 0.5s
+				Allocator::ThreadFlush(allocator_flush_threshold);
+				if (!queue->semaphore.wait(Allocator::DecayDelay() * 1000000 - INITIAL_FLUSH_WAIT)) {
+					// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
+					// mark it as idle and start an untimed wait
+					Allocator::ThreadIdle();
+					queue->semaphore.wait();
+				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->q.try_dequeue(consumer_token, task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -190,8 +211,16 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			case TaskExecutionResult::TASK_BLOCKED:
 				task->Deschedule();
 				task.reset();
+				if (thread) {
+					thread->tasks_blocked++;
+				}
 				break;
 			}
+			if (thread) {
+				thread->tasks_executed++;
+			}
+		} else if (thread) {
+			thread->failed_dequeues++;
 		}
 	}
 	// this thread will exit, flush all of its outstanding allocations
@@ -267,8 +296,8 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, SchedulerThread *thread) {
+	scheduler->ExecuteForever(marker, thread);
 }
 #endif
 
@@ -276,6 +305,22 @@ int32_t TaskScheduler::NumberOfThreads() {
 	return current_thread_count.load();
 }
 
+vector<SchedulerThreadInformation> TaskScheduler::GetThreadInformation() {
+	lock_guard<mutex> t(thread_lock);
+	vector<SchedulerThreadInformation> result;
+	for (idx_t thread_idx = 0; thread_idx < threads.size(); thread_idx++) {
+		auto &thread = *threads[thread_idx];
+		SchedulerThreadInformation info;
+		info.thread_id = thread_idx;
+		info.tasks_executed = thread.tasks_executed;
+		info.tasks_blocked = thread.tasks_blocked;
+		info.idle_count = thread.idle_count;
+		info.failed_dequeues = thread.failed_dequeues;
+		result.push_back(info);
+	}
+	return result;
+}
+
 void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 	if (total_threads == 0) {
 		throw SyntaxException("Number of threads must be positive!");
@@ -302,6 +347,40 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 	Allocator::SetBackgroundThreads(enable);
 }
 
+void TaskScheduler::SetThreadPinMode(ThreadPinMode mode) {
+	lock_guard<mutex> t(thread_lock);
+	if (thread_pin_mode == mode) {
+		return;
+	}
+	thread_pin_mode = mode;
+	for (idx_t thread_idx = 0; thread_idx < threads.size(); thread_idx++) {
+		PinThread(thread_idx);
+	}
+}
+
+void TaskScheduler::PinThread(idx_t thread_idx) {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	auto cpus = numa_topology.GetThreadCPUs(thread_pin_mode, thread_idx);
+	if (cpus.empty()) {
+		// the thread is not pinned - allow it to run on all CPUs (in case it was pinned before)
+		cpus = numa_topology.GetAllCPUs();
+		if (cpus.empty()) {
+			return;
+		}
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// pinning is a performance optimization - ignore failures (e.g., when the CPUs are restricted by a cgroup)
+	auto &internal_thread = *threads[thread_idx]->internal_thread;
+	pthread_setaffinity_np(internal_thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
@@ -377,18 +456,19 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
-			unique_ptr<thread> worker_thread;
+			auto thread_wrapper = make_uniq<SchedulerThread>();
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				thread_wrapper->internal_thread =
+				    make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), thread_wrapper.get());
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
-			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
+			PinThread(threads.size() - 1);
 		}
 	}
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
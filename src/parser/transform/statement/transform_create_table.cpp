@@ -66,6 +66,27 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+string Transformer::TransformClusterBy(optional_ptr<duckdb_libpgquery::PGNode> arg) {
+	if (arg) {
+		switch (arg->type) {
+		case duckdb_libpgquery::T_PGString:
+			// cluster_by = 'column'
+			return PGPointerCast<duckdb_libpgquery::PGValue>(arg.get())->val.str;
+		case duckdb_libpgquery::T_PGTypeName: {
+			// cluster_by = column
+			auto type_name = PGPointerCast<duckdb_libpgquery::PGTypeName>(arg.get());
+			if (type_name->names && type_name->names->length == 1 && !type_name->typmods && !type_name->arrayBounds) {
+				return PGPointerCast<duckdb_libpgquery::PGValue>(type_name->names->head->data.ptr_value)->val.str;
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	throw ParserException("The cluster_by option expects the name of a column, e.g. WITH (cluster_by = 'col')");
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -124,6 +145,17 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 		throw ParserException("Table must have at least one column!");
 	}
 
+	if (stmt.options) {
+		duckdb_libpgquery::PGListCell *cell;
+		for_each_cell(cell, stmt.options->head) {
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+			if (StringUtil::Lower(def_elem->defname) != "cluster_by") {
+				continue;
+			}
+			info->cluster_by = TransformClusterBy(def_elem->arg);
+		}
+	}
+
 	result->info = std::move(info);
 	return result;
 }
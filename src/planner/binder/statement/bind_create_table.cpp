@@ -343,6 +343,17 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	if (base.columns.PhysicalColumnCount() == 0) {
 		throw BinderException("Creating a table without physical (non-generated) columns is not supported");
 	}
+	if (!base.cluster_by.empty()) {
+		if (!base.columns.ColumnExists(base.cluster_by)) {
+			throw BinderException(
+			    "Cannot cluster table \"%s\" by \"%s\": the table does not have a column with this name", base.table,
+			    base.cluster_by);
+		}
+		if (base.columns.GetColumn(base.cluster_by).Generated()) {
+			throw BinderException("Cannot cluster table \"%s\" by generated column \"%s\"", base.table,
+			                      base.cluster_by);
+		}
+	}
 	// bind collations to detect any unsupported collation errors
 	for (idx_t i = 0; i < base.columns.PhysicalColumnCount(); i++) {
 		auto &column = base.columns.GetColumnMutable(PhysicalIndex(i));
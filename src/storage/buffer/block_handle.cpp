@@ -11,18 +11,23 @@ namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_seq_num(0),
-      can_destroy(false), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
+      frequently_used(false), eviction_queue_insertion(DConstants::INVALID_INDEX), can_destroy(false),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	eviction_seq_num = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = block_manager.GetBlockAllocSize();
+	if (block_id < MAXIMUM_BLOCK) {
+		// the memory of persistent blocks is accounted to the database they belong to
+		memory_charge.database_memory = &block_manager.memory_usage;
+	}
 }
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag,
                          unique_ptr<FileBuffer> buffer_p, bool can_destroy_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0),
-      can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
-      unswizzled(nullptr) {
+      frequently_used(false), eviction_queue_insertion(DConstants::INVALID_INDEX), can_destroy(can_destroy_p),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -32,16 +37,17 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	// being destroyed, so any unswizzled pointers are just binary junk now.
 	unswizzled = nullptr;
-	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
+	if (buffer && buffer->type != FileBufferType::TINY_BUFFER && !IsMemoryMapped()) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes(buffer->type);
+		buffer_manager.GetBufferPool().IncrementDeadNodes(*this);
 	}
 
 	// no references remain to this block: erase
 	if (buffer && state == BlockState::BLOCK_LOADED) {
-		D_ASSERT(memory_charge.size > 0);
+		D_ASSERT(memory_charge.size > 0 || IsMemoryMapped());
 		// the block is still loaded in memory: erase it
+		block_manager.buffer_manager.GetBufferPool().RemoveFrequentlyUsed(*this);
 		buffer.reset();
 		memory_charge.Resize(0);
 	} else {
@@ -89,7 +95,9 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	}
 
 	auto &block_manager = handle->block_manager;
-	if (handle->block_id < MAXIMUM_BLOCK) {
+	if (handle->IsMemoryMapped()) {
+		handle->buffer = block_manager.ReadMappedBlock(handle->block_id);
+	} else if (handle->block_id < MAXIMUM_BLOCK) {
 		auto block = AllocateBlock(block_manager, std::move(reusable_buffer), handle->block_id);
 		block_manager.Read(*block);
 		handle->buffer = std::move(block);
@@ -117,6 +125,9 @@ unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 		// temporary block that cannot be destroyed: write to temporary file
 		block_manager.buffer_manager.WriteTemporaryBuffer(tag, block_id, *buffer);
 	}
+	// once the block is loaded again it starts out as a block that was used only once
+	block_manager.buffer_manager.GetBufferPool().RemoveFrequentlyUsed(*this);
+	eviction_queue_insertion = DConstants::INVALID_INDEX;
 	memory_charge.Resize(0);
 	state = BlockState::BLOCK_UNLOADED;
 	return std::move(buffer);
@@ -127,6 +138,10 @@ void BlockHandle::Unload() {
 	block.reset();
 }
 
+bool BlockHandle::IsMemoryMapped() const {
+	return block_id < MAXIMUM_BLOCK && block_manager.IsMemoryMapped();
+}
+
 bool BlockHandle::CanUnload() {
 	if (state == BlockState::BLOCK_UNLOADED) {
 		// already unloaded
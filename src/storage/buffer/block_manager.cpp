@@ -4,11 +4,13 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/metadata/metadata_manager.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
 BlockManager::BlockManager(BufferManager &buffer_manager, const optional_idx block_alloc_size_p)
     : buffer_manager(buffer_manager), metadata_manager(make_uniq<MetadataManager>(*this, buffer_manager)),
-      block_alloc_size(block_alloc_size_p) {
+      block_alloc_size(block_alloc_size_p), memory_usage(0), memory_reservation(0) {
 }
 
 shared_ptr<BlockHandle> BlockManager::RegisterBlock(block_id_t block_id) {
@@ -81,6 +83,38 @@ void BlockManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
 	}
 }
 
+vector<block_id_t> BlockManager::GetLoadedBlocks() {
+	// collect the handles while holding the lock
+	// we release them outside of the lock, as destroying the last reference of a handle unregisters the block
+	vector<shared_ptr<BlockHandle>> handles;
+	{
+		lock_guard<mutex> lock(blocks_lock);
+		for (auto &entry : blocks) {
+			auto handle = entry.second.lock();
+			if (handle) {
+				handles.push_back(std::move(handle));
+			}
+		}
+	}
+	vector<block_id_t> frequently_used;
+	vector<block_id_t> result;
+	for (auto &handle : handles) {
+		lock_guard<mutex> guard(handle->lock);
+		if (handle->IsUnloaded()) {
+			continue;
+		}
+		if (handle->frequently_used) {
+			frequently_used.push_back(handle->BlockId());
+		} else {
+			result.push_back(handle->BlockId());
+		}
+	}
+	std::sort(frequently_used.begin(), frequently_used.end());
+	std::sort(result.begin(), result.end());
+	frequently_used.insert(frequently_used.end(), result.begin(), result.end());
+	return frequently_used;
+}
+
 MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
@@ -88,4 +122,11 @@ MetadataManager &BlockManager::GetMetadataManager() {
 void BlockManager::Truncate() {
 }
 
+void BlockManager::ReadAhead(block_id_t start_block, idx_t block_count) {
+}
+
+unique_ptr<Block> BlockManager::ReadMappedBlock(block_id_t block_id) {
+	throw InternalException("BlockManager::ReadMappedBlock called on a block manager that is not memory-mapped");
+}
+
 } // namespace duckdb
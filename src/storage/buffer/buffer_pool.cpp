@@ -5,6 +5,7 @@
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
@@ -61,6 +62,10 @@ public:
 	inline void DecrementDeadNodes() {
 		total_dead_nodes--;
 	}
+	//! The total number of insertions into the eviction queue
+	inline idx_t GetInsertionCount() const {
+		return evict_queue_insertions;
+	}
 
 private:
 	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
@@ -192,11 +197,18 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	total_dead_nodes -= actually_dequeued - alive_nodes;
 }
 
+//! A block that is re-used is only considered frequently used if at least this many blocks were added to the eviction
+//! queue since it was last used, i.e., re-using a block within e.g. the same scan does not count
+static constexpr idx_t CORRELATED_REFERENCE_PERIOD = 128;
+//! Frequently used blocks are evicted first if they take up more than 3/4th of the memory limit
+static constexpr idx_t FREQUENTLY_USED_MEMORY_NUMERATOR = 3;
+static constexpr idx_t FREQUENTLY_USED_MEMORY_DENOMINATOR = 4;
+
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
-    : maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
+    : maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps), frequently_used_memory(0),
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+	queues.reserve(FILE_BUFFER_TYPE_COUNT + 1);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT + 1; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
 }
@@ -204,8 +216,6 @@ BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
@@ -219,10 +229,23 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		GetEvictionQueueForBlockHandle(*handle).IncrementDeadNodes();
+	}
+
+	if (handle->buffer->type == FileBufferType::BLOCK && !handle->frequently_used) {
+		auto insertions = GetEvictionQueueForType(FileBufferType::BLOCK).GetInsertionCount();
+		if (handle->eviction_queue_insertion == DConstants::INVALID_INDEX) {
+			// the block is added for the first time since it was loaded
+			handle->eviction_queue_insertion = insertions;
+		} else if (insertions - handle->eviction_queue_insertion >= CORRELATED_REFERENCE_PERIOD) {
+			// the block was re-used after other blocks were used - move it to the frequently used blocks
+			handle->frequently_used = true;
+			frequently_used_memory += handle->memory_usage;
+		}
 	}
 
-	// Get the eviction queue for the buffer type and add it
+	// Get the eviction queue for the block handle and add it
+	auto &queue = GetEvictionQueueForBlockHandle(*handle);
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
@@ -230,8 +253,27 @@ EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+EvictionQueue &BufferPool::GetEvictionQueueForBlockHandle(const BlockHandle &handle) {
+	if (handle.frequently_used) {
+		return GetFrequentlyUsedEvictionQueue();
+	}
+	return GetEvictionQueueForType(handle.buffer->type);
+}
+
+EvictionQueue &BufferPool::GetFrequentlyUsedEvictionQueue() {
+	return *queues[FILE_BUFFER_TYPE_COUNT];
+}
+
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	GetEvictionQueueForBlockHandle(handle).IncrementDeadNodes();
+}
+
+void BufferPool::RemoveFrequentlyUsed(BlockHandle &handle) {
+	if (!handle.frequently_used) {
+		return;
+	}
+	handle.frequently_used = false;
+	frequently_used_memory -= handle.memory_usage;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -257,11 +299,25 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
 	// First, we try to evict persistent table data
+	// blocks that were used only once are evicted before frequently used blocks - unless the frequently used blocks
+	// take up more than their share of the memory limit
+	auto &frequently_used_queue = GetFrequentlyUsedEvictionQueue();
+	if (frequently_used_memory * FREQUENTLY_USED_MEMORY_DENOMINATOR > memory_limit * FREQUENTLY_USED_MEMORY_NUMERATOR) {
+		auto frequently_used_result =
+		    EvictBlocksInternal(frequently_used_queue, tag, extra_memory, memory_limit, buffer);
+		if (frequently_used_result.success) {
+			return frequently_used_result;
+		}
+	}
 	auto block_result =
 	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
 	if (block_result.success) {
 		return block_result;
 	}
+	auto frequently_used_result = EvictBlocksInternal(frequently_used_queue, tag, extra_memory, memory_limit, buffer);
+	if (frequently_used_result.success) {
+		return frequently_used_result;
+	}
 
 	// If that does not succeed, we try to evict temporary data
 	auto managed_buffer_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::MANAGED_BUFFER), tag,
@@ -284,7 +340,16 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 		return {true, std::move(r)};
 	}
 
-	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+	// blocks of databases that are within their memory reservation are moved to the back of the queue
+	// we stop once we have seen (approximately) all nodes in the queue
+	idx_t reserved_blocks = 0;
+	auto max_reserved_blocks = queue.q.size_approx();
+	queue.IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
+		if (handle->block_manager.IsWithinMemoryReservation()) {
+			queue.q.enqueue(std::move(node));
+			return ++reserved_blocks <= max_reserved_blocks;
+		}
+
 		// hooray, we can unload the block
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
@@ -373,6 +438,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		GetFrequentlyUsedEvictionQueue().Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -6,12 +6,20 @@ namespace duckdb {
 BufferPoolReservation::BufferPoolReservation(MemoryTag tag, BufferPool &pool) : tag(tag), pool(pool) {
 }
 
-BufferPoolReservation::BufferPoolReservation(BufferPoolReservation &&src) noexcept : tag(src.tag), pool(src.pool) {
+BufferPoolReservation::BufferPoolReservation(BufferPoolReservation &&src) noexcept
+    : tag(src.tag), pool(src.pool), database_memory(src.database_memory) {
 	size = src.size;
 	src.size = 0;
 }
 
 BufferPoolReservation &BufferPoolReservation::operator=(BufferPoolReservation &&src) noexcept {
+	// the reservation keeps accounting its memory to its own database (if any)
+	if (src.database_memory) {
+		*src.database_memory -= src.size;
+	}
+	if (database_memory) {
+		*database_memory += src.size - size;
+	}
 	tag = src.tag;
 	size = src.size;
 	src.size = 0;
@@ -25,10 +33,19 @@ BufferPoolReservation::~BufferPoolReservation() {
 void BufferPoolReservation::Resize(idx_t new_size) {
 	auto delta = UnsafeNumericCast<int64_t>(new_size) - UnsafeNumericCast<int64_t>(size);
 	pool.UpdateUsedMemory(tag, delta);
+	if (database_memory) {
+		*database_memory += new_size - size;
+	}
 	size = new_size;
 }
 
 void BufferPoolReservation::Merge(BufferPoolReservation src) {
+	if (src.database_memory) {
+		*src.database_memory -= src.size;
+	}
+	if (database_memory) {
+		*database_memory += src.size;
+	}
 	size += src.size;
 	src.size = 0;
 }
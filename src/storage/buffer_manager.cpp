@@ -20,6 +20,9 @@ Allocator &BufferManager::GetBufferAllocator() {
 	throw NotImplementedException("This type of BufferManager does not have an Allocator");
 }
 
+void BufferManager::ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+}
+
 void BufferManager::ReserveMemory(idx_t size) {
 	throw NotImplementedException("This type of BufferManager can not reserve memory");
 }
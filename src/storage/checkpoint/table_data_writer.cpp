@@ -4,6 +4,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 
@@ -16,15 +17,41 @@ TableDataWriter::TableDataWriter(TableCatalogEntry &table_p) : table(table_p.Cas
 TableDataWriter::~TableDataWriter() {
 }
 
+void TableDataWriter::ScheduleTableData() {
+	D_ASSERT(!checkpoint_state);
+	checkpoint_state = table.GetStorage().ScheduleCheckpoint(*this);
+}
+
+idx_t TableDataWriter::GetScheduledRowGroupCount() const {
+	return checkpoint_state ? checkpoint_state->segments.size() : 0;
+}
+
+void TableDataWriter::FinishScheduledTasks() {
+	// destroying the checkpoint state waits for any of its tasks that are still running
+	checkpoint_state.reset();
+}
+
 void TableDataWriter::WriteTableData(Serializer &metadata_serializer) {
-	// start scanning the table and append the data to the uncompressed segments
-	table.GetStorage().Checkpoint(*this, metadata_serializer);
+	if (!checkpoint_state) {
+		// start scanning the table and append the data to the uncompressed segments
+		ScheduleTableData();
+	}
+	table.GetStorage().Checkpoint(*this, *checkpoint_state, metadata_serializer);
+	checkpoint_state.reset();
 }
 
 CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+optional_idx TableDataWriter::GetClusterColumn() {
+	auto &cluster_by = table.GetClusterBy();
+	if (cluster_by.empty()) {
+		return optional_idx();
+	}
+	return table.GetColumn(cluster_by).Physical().index;
+}
+
 void TableDataWriter::AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer) {
 	row_group_pointers.push_back(std::move(row_group_pointer));
 }
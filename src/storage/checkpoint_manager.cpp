@@ -18,6 +18,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -41,6 +42,9 @@ SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, Blo
       checkpoint_type(checkpoint_type) {
 }
 
+SingleFileCheckpointWriter::~SingleFileCheckpointWriter() {
+}
+
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
 	auto &storage_manager = db.GetStorageManager().Cast<SingleFileStorageManager>();
 	return *storage_manager.block_manager;
@@ -170,6 +174,11 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	    }
 	 */
 	auto catalog_entries = GetCatalogEntries(schemas);
+	for (auto &entry : catalog_entries) {
+		if (entry.get().type == CatalogType::TABLE_ENTRY) {
+			tables.push_back(entry.get().Cast<TableCatalogEntry>());
+		}
+	}
 	SerializationOptions serialization_options;
 
 	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
@@ -491,17 +500,80 @@ void CheckpointReader::ReadTableMacro(CatalogTransaction transaction, Deserializ
 //===--------------------------------------------------------------------===//
 // Table Metadata
 //===--------------------------------------------------------------------===//
+void SingleFileCheckpointWriter::ScheduleTables() {
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	if (thread_count <= 1) {
+		// no background threads to write tables ahead of time
+		return;
+	}
+	// bound the amount of row groups that are in-flight
+	auto max_row_groups = thread_count * CHECKPOINT_ROW_GROUPS_PER_THREAD;
+	while (next_table_idx < tables.size() && scheduled_row_groups < max_row_groups) {
+		auto &table = tables[next_table_idx].get();
+		CheckpointTableData table_data(table);
+		table_data.checkpoint_lock = table.GetStorage().TryGetCheckpointLock();
+		if (!table_data.checkpoint_lock) {
+			// the table is in use - it is written once it is serialized instead
+			// we stop scheduling here so that we never wait for the lock of a table while holding that of another
+			break;
+		}
+		next_table_idx++;
+		table_data.writer = GetTableDataWriter(table);
+		if (table_data.writer) {
+			table_data.writer->ScheduleTableData();
+			table_data.row_group_count = table_data.writer->GetScheduledRowGroupCount();
+		}
+		scheduled_row_groups += table_data.row_group_count;
+		scheduled_tables.push_back(std::move(table_data));
+	}
+}
+
+CheckpointTableData::CheckpointTableData(TableCatalogEntry &table) : table(table) {
+}
+
+CheckpointTableData::CheckpointTableData(CheckpointTableData &&other) noexcept = default;
+
+CheckpointTableData::~CheckpointTableData() {
+	if (writer) {
+		// if the checkpoint failed the row groups of this table might still be in the process of being written
+		writer->FinishScheduledTasks();
+	}
+}
+
+CheckpointTableData SingleFileCheckpointWriter::GetTableData(TableCatalogEntry &table) {
+	if (!scheduled_tables.empty() && RefersToSameObject(scheduled_tables.front().table.get(), table)) {
+		// the table was already scheduled
+		auto table_data = std::move(scheduled_tables.front());
+		scheduled_tables.pop_front();
+		scheduled_row_groups -= table_data.row_group_count;
+		return table_data;
+	}
+	// the table was not scheduled - wait for its lock
+	D_ASSERT(scheduled_tables.empty());
+	CheckpointTableData table_data(table);
+	table_data.checkpoint_lock = table.GetStorage().GetCheckpointLock();
+	table_data.writer = GetTableDataWriter(table);
+	if (next_table_idx < tables.size() && RefersToSameObject(tables[next_table_idx].get(), table)) {
+		next_table_idx++;
+	}
+	return table_data;
+}
+
 void SingleFileCheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer &serializer) {
 	// Write the table metadata
 	serializer.WriteProperty(100, "table", &table);
 
 	// Write the table data
-	auto table_lock = table.GetStorage().GetCheckpointLock();
-	if (auto writer = GetTableDataWriter(table)) {
-		writer->WriteTableData(serializer);
+	auto table_data = GetTableData(table);
+	// keep the background threads busy with the row groups of the next tables while we finish this one
+	ScheduleTables();
+	if (table_data.writer) {
+		table_data.writer->WriteTableData(serializer);
 	}
 	// flush any partial blocks BEFORE releasing the table lock
 	// flushing partial blocks updates where data lives and is not thread-safe
+	auto partial_block_lock = partial_block_manager.GetLock();
 	partial_block_manager.FlushPartialBlocks();
 }
 
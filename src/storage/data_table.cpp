@@ -14,6 +14,7 @@
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/table/standard_column_data.hpp"
@@ -1414,18 +1415,26 @@ unique_ptr<StorageLockKey> DataTable::GetCheckpointLock() {
 	return info->checkpoint_lock.GetExclusiveLock();
 }
 
-void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
+unique_ptr<StorageLockKey> DataTable::TryGetCheckpointLock() {
+	return info->checkpoint_lock.TryGetExclusiveLock();
+}
+
+unique_ptr<CollectionCheckpointState> DataTable::ScheduleCheckpoint(TableDataWriter &writer) {
+	// schedule the compression of each individual row group
+	return row_groups->ScheduleCheckpoint(writer);
+}
+
+void DataTable::Checkpoint(TableDataWriter &writer, CollectionCheckpointState &checkpoint_state,
+                           Serializer &serializer) {
 	// checkpoint each individual row group
-	TableStatistics global_stats;
-	row_groups->CopyStats(global_stats);
-	row_groups->Checkpoint(writer, global_stats);
+	row_groups->Checkpoint(checkpoint_state);
 
 	// The row group payload data has been written. Now write:
 	//   column stats
 	//   row-group pointers
 	//   table pointer
 	//   index data
-	writer.FinalizeTable(global_stats, info.get(), serializer);
+	writer.FinalizeTable(checkpoint_state.global_stats, info.get(), serializer);
 }
 
 void DataTable::CommitDropColumn(idx_t index) {
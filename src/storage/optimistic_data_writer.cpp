@@ -22,6 +22,10 @@ bool OptimisticDataWriter::PrepareWrite() {
 	if (table.IsTemporary() || StorageManager::Get(table.GetAttached()).InMemory()) {
 		return false;
 	}
+	if (table.GetDataTableInfo()->IsClustered()) {
+		// the rows of clustered tables are sorted when they are checkpointed - keep them in memory until then
+		return false;
+	}
 	// we should! write the second-to-last row group to disk
 	// allocate the partial block-manager if none is allocated yet
 	if (!partial_manager) {
@@ -3,10 +3,16 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/database_size.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/metadata/metadata_writer.hpp"
 
@@ -147,6 +153,16 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, const strin
       iteration_count(0), options(options) {
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+	StopWarmup();
+	if (mapped_file) {
+		try {
+			handle->file_system.UnmapFile(*handle, mapped_file, mapped_size);
+		} catch (...) { // NOLINT
+		}
+	}
+}
+
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
 	FileOpenFlags result;
 	if (options.read_only) {
@@ -257,6 +273,24 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 		Initialize(h2, GetOptionalBlockAllocSize());
 	}
 	LoadFreeList();
+	MapFile();
+}
+
+void SingleFileBlockManager::MapFile() {
+	if (!options.read_only || !options.use_mmap || options.use_direct_io || !handle->OnDiskFile()) {
+		return;
+	}
+	auto file_size = handle->GetFileSize();
+	if (file_size == 0) {
+		return;
+	}
+	// the file is immutable while it is attached in read-only mode, so we can map it in its entirety
+	// if the file system does not support mapping, we fall back to reading the blocks into the buffer pool
+	mapped_size = file_size;
+	mapped_file = handle->file_system.MapFile(*handle, mapped_size);
+	if (!mapped_file) {
+		mapped_size = 0;
+	}
 }
 
 void SingleFileBlockManager::ReadAndChecksum(FileBuffer &block, uint64_t location) const {
@@ -469,6 +503,32 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, GetBlockLocation(block.id));
 }
 
+unique_ptr<Block> SingleFileBlockManager::ReadMappedBlock(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	D_ASSERT(IsMemoryMapped());
+	auto location = GetBlockLocation(block_id);
+	if (location + GetBlockAllocSize() > mapped_size) {
+		throw IOException("Corrupt database file: block at location %llu is out of range of the file of size %llu",
+		                  location, mapped_size);
+	}
+	auto result = make_uniq<MappedBlock>(Allocator::Get(db), block_id, mapped_file + location, GetBlockAllocSize());
+
+	// verify the checksum - the pages of the block are faulted in as we do so
+	auto stored_checksum = Load<uint64_t>(result->InternalBuffer());
+	auto computed_checksum = Checksum(result->buffer, result->size);
+	if (stored_checksum != computed_checksum) {
+		throw IOException("Corrupt database file: computed checksum %llu does not match stored checksum %llu in block "
+		                  "at location %llu",
+		                  computed_checksum, stored_checksum, location);
+	}
+	return std::move(result);
+}
+
+void SingleFileBlockManager::ReadAhead(block_id_t start_block, idx_t block_count) {
+	D_ASSERT(start_block >= 0);
+	handle->ReadAhead(GetBlockLocation(start_block), block_count * GetBlockAllocSize());
+}
+
 void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	D_ASSERT(start_block >= 0);
 	D_ASSERT(block_count >= 1);
@@ -567,6 +627,10 @@ protected:
 };
 
 void SingleFileBlockManager::WriteHeader(DatabaseHeader header) {
+	// the blocks that were freed by this checkpoint can be re-used after the header is written
+	// stop the warmup so it does not hold on to (or load) any blocks whose id might be re-used
+	StopWarmup();
+
 	auto free_list_blocks = GetFreeListBlocks();
 
 	// now handle the free list
@@ -657,4 +721,207 @@ void SingleFileBlockManager::TrimFreeBlocks() {
 	newly_freed_list.clear();
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Pool Warmup
+//===--------------------------------------------------------------------===//
+static constexpr const uint64_t WARMUP_FILE_VERSION = 1;
+//! The number of blocks that are loaded by the warmup task at a time
+static constexpr const idx_t WARMUP_BATCH_SIZE = 64;
+
+struct BufferPoolWarmupState {
+	explicit BufferPoolWarmupState(SingleFileBlockManager &manager) : manager(&manager) {
+	}
+
+	//! Held while a batch of blocks is loaded
+	mutex lock;
+	//! The block manager - set to nullptr when the warmup is stopped
+	optional_ptr<SingleFileBlockManager> manager;
+};
+
+class BufferPoolWarmupTask : public Task {
+public:
+	BufferPoolWarmupTask(shared_ptr<BufferPoolWarmupState> state_p, vector<block_id_t> block_ids_p)
+	    : state(std::move(state_p)), block_ids(std::move(block_ids_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		for (idx_t offset = 0; offset < block_ids.size(); offset += WARMUP_BATCH_SIZE) {
+			auto end = MinValue<idx_t>(offset + WARMUP_BATCH_SIZE, block_ids.size());
+			vector<block_id_t> batch(block_ids.begin() + NumericCast<int64_t>(offset),
+			                         block_ids.begin() + NumericCast<int64_t>(end));
+			lock_guard<mutex> guard(state->lock);
+			if (!state->manager) {
+				break;
+			}
+			try {
+				if (!state->manager->WarmupBlocks(batch)) {
+					break;
+				}
+			} catch (...) { // NOLINT
+				// the warmup is only an optimization - errors (e.g. running out of memory) stop it
+				break;
+			}
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<BufferPoolWarmupState> state;
+	vector<block_id_t> block_ids;
+};
+
+string SingleFileBlockManager::GetWarmupPath() const {
+	return path + ".warmup";
+}
+
+void SingleFileBlockManager::WriteWarmupFile() {
+	auto &config = DBConfig::Get(db);
+	if (!config.options.buffer_pool_warmup) {
+		return;
+	}
+	// metadata blocks are not recorded: they are loaded when the database is attached and can be rewritten in-place
+	unordered_set<block_id_t> metadata_blocks;
+	for (auto &info : GetMetadataManager().GetMetadataInfo()) {
+		metadata_blocks.insert(info.block_id);
+	}
+	vector<block_id_t> block_ids;
+	for (auto &block_id : GetLoadedBlocks()) {
+		if (metadata_blocks.find(block_id) == metadata_blocks.end()) {
+			block_ids.push_back(block_id);
+		}
+	}
+	uint64_t iteration;
+	{
+		lock_guard<mutex> lock(block_lock);
+		iteration = iteration_count;
+	}
+
+	// write the block ids to a temporary file first, so that a crash never leaves behind a partially written file
+	auto &fs = FileSystem::Get(db);
+	auto warmup_path = GetWarmupPath();
+	auto temp_path = warmup_path + ".tmp";
+	try {
+		BufferedFileWriter writer(fs, temp_path);
+		writer.Write<uint64_t>(WARMUP_FILE_VERSION);
+		writer.Write<uint64_t>(iteration);
+		writer.Write<uint64_t>(block_ids.size());
+		for (auto &block_id : block_ids) {
+			writer.Write<block_id_t>(block_id);
+		}
+		writer.Sync();
+		writer.Close();
+		if (fs.FileExists(warmup_path)) {
+			fs.RemoveFile(warmup_path);
+		}
+		fs.MoveFile(temp_path, warmup_path);
+	} catch (...) { // NOLINT
+		// the warmup file is only a hint - failing to write it should not fail the checkpoint
+	}
+}
+
+void SingleFileBlockManager::StartWarmup() {
+	auto &config = DBConfig::Get(db);
+	if (!config.options.buffer_pool_warmup || IsMemoryMapped()) {
+		return;
+	}
+	auto &fs = FileSystem::Get(db);
+	auto warmup_handle =
+	    fs.OpenFile(GetWarmupPath(), FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!warmup_handle) {
+		return;
+	}
+	vector<block_id_t> block_ids;
+	try {
+		BufferedFileReader reader(fs, std::move(warmup_handle));
+		auto version = reader.Read<uint64_t>();
+		auto iteration = reader.Read<uint64_t>();
+		if (version != WARMUP_FILE_VERSION || iteration != iteration_count) {
+			// the file was written by a different version, or the database has been checkpointed since
+			return;
+		}
+		auto block_count = reader.Read<uint64_t>();
+		for (idx_t i = 0; i < block_count; i++) {
+			block_ids.push_back(reader.Read<block_id_t>());
+		}
+	} catch (...) { // NOLINT
+		// the warmup file is only a hint - ignore it if it cannot be read
+		return;
+	}
+
+	// only load blocks that are in use, and that are not metadata blocks
+	unordered_set<block_id_t> metadata_blocks;
+	for (auto &info : GetMetadataManager().GetMetadataInfo()) {
+		metadata_blocks.insert(info.block_id);
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto used_memory = buffer_manager.GetUsedMemory();
+	auto max_memory = buffer_manager.GetMaxMemory();
+	auto max_blocks = used_memory < max_memory ? (max_memory - used_memory) / GetBlockAllocSize() : 0;
+	vector<block_id_t> warmup_block_ids;
+	{
+		lock_guard<mutex> lock(block_lock);
+		for (auto &block_id : block_ids) {
+			if (warmup_block_ids.size() >= max_blocks) {
+				// the blocks are recorded in order of importance - we only load as many as fit in memory
+				break;
+			}
+			if (block_id < 0 || block_id >= max_block || free_list.find(block_id) != free_list.end() ||
+			    metadata_blocks.find(block_id) != metadata_blocks.end()) {
+				continue;
+			}
+			warmup_block_ids.push_back(block_id);
+		}
+	}
+	if (warmup_block_ids.empty()) {
+		return;
+	}
+	// load the blocks in order, so that adjacent blocks can be read at once
+	std::sort(warmup_block_ids.begin(), warmup_block_ids.end());
+
+	warmup = make_shared_ptr<BufferPoolWarmupState>(*this);
+	shared_ptr<Task> task = make_shared_ptr<BufferPoolWarmupTask>(warmup, std::move(warmup_block_ids));
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (scheduler.NumberOfThreads() <= NumericCast<int32_t>(config.options.external_threads)) {
+		// there are no background threads that can pick up the task - load the blocks while attaching instead
+		task->Execute(TaskExecutionMode::PROCESS_ALL);
+		return;
+	}
+	auto token = scheduler.CreateProducer();
+	scheduler.ScheduleTask(*token, std::move(task));
+}
+
+bool SingleFileBlockManager::WarmupBlocks(const vector<block_id_t> &block_ids) {
+	// stop if loading the blocks would exceed the memory limit
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto required_memory = block_ids.size() * GetBlockAllocSize();
+	if (buffer_manager.GetUsedMemory() + required_memory > buffer_manager.GetMaxMemory()) {
+		return false;
+	}
+	vector<shared_ptr<BlockHandle>> handles;
+	for (auto &block_id : block_ids) {
+		handles.push_back(RegisterBlock(block_id));
+	}
+	// read runs of adjacent blocks at once, and load any remaining blocks individually
+	buffer_manager.Prefetch(handles);
+	for (auto &handle : handles) {
+		if (handle->IsUnloaded()) {
+			buffer_manager.Pin(handle);
+		}
+	}
+	// keep the handles alive, so that the blocks remain loaded until they are used
+	for (auto &handle : handles) {
+		warmup_blocks.push_back(std::move(handle));
+	}
+	return true;
+}
+
+void SingleFileBlockManager::StopWarmup() {
+	if (!warmup) {
+		return;
+	}
+	lock_guard<mutex> guard(warmup->lock);
+	warmup->manager = nullptr;
+	warmup_blocks.clear();
+}
+
 } // namespace duckdb
@@ -273,6 +273,10 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
+	if (handles[0]->block_manager.IsMemoryMapped()) {
+		// blocks of a memory-mapped file are not copied into buffers - there is nothing to batch
+		return;
+	}
 	// iterate over the blocks and perform bulk reads
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
@@ -298,6 +302,38 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
 }
 
+void StandardBufferManager::ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	if (handles.empty()) {
+		return;
+	}
+	// figure out which blocks are not loaded yet - in order of their block id
+	set<block_id_t> to_be_read;
+	for (auto &handle : handles) {
+		lock_guard<mutex> lock(handle->lock);
+		if (handle->state != BlockState::BLOCK_LOADED) {
+			to_be_read.insert(handle->BlockId());
+		}
+	}
+	// issue a read-ahead for each range of adjacent blocks
+	auto &block_manager = handles[0]->block_manager;
+	block_id_t first_block = -1;
+	block_id_t previous_block_id = -1;
+	for (auto &block_id : to_be_read) {
+		if (previous_block_id >= 0 && previous_block_id + 1 == block_id) {
+			previous_block_id = block_id;
+			continue;
+		}
+		if (previous_block_id >= 0) {
+			block_manager.ReadAhead(first_block, NumericCast<idx_t>(previous_block_id - first_block + 1));
+		}
+		first_block = block_id;
+		previous_block_id = block_id;
+	}
+	if (previous_block_id >= 0) {
+		block_manager.ReadAhead(first_block, NumericCast<idx_t>(previous_block_id - first_block + 1));
+	}
+}
+
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// we need to be careful not to return the BufferHandle to this block while holding the BlockHandle's lock
 	// as exiting this function's scope may cause the destructor of the BufferHandle to be called while holding the lock
@@ -313,6 +349,11 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			// the block is loaded, increment the reader count and set the BufferHandle
 			handle->readers++;
 			buf = handle->Load(handle);
+		} else if (handle->IsMemoryMapped()) {
+			// the block points into the memory mapping of the file: we do not need to reserve memory to load it
+			D_ASSERT(handle->readers == 0);
+			buf = handle->Load(handle);
+			handle->readers = 1;
 		}
 		required_memory = handle->memory_usage;
 	}
@@ -385,7 +426,7 @@ void StandardBufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 		}
 		D_ASSERT(handle->readers > 0);
 		handle->readers--;
-		if (handle->readers == 0) {
+		if (handle->readers == 0 && !handle->IsMemoryMapped()) {
 			VerifyZeroReaders(handle);
 			purge = buffer_pool.AddToEvictionQueue(handle);
 		}
@@ -472,7 +513,8 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 	// Create the file and write the size followed by the buffer contents.
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
-	temporary_directory.handle->GetTempFile().IncreaseSizeOnDisk(buffer.size + sizeof(idx_t));
+	// the whole allocation is written, and the file size is subtracted again when the file is deleted
+	temporary_directory.handle->GetTempFile().IncreaseSizeOnDisk(buffer.AllocSize() + sizeof(idx_t));
 	handle->Write(&buffer.size, sizeof(idx_t), 0);
 	buffer.Write(*handle, sizeof(idx_t));
 }
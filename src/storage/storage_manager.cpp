@@ -157,6 +157,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 	StorageManagerOptions options;
 	options.read_only = read_only;
 	options.use_direct_io = config.options.use_direct_io;
+	options.use_mmap = config.options.use_mmap;
 	options.debug_initialize = config.options.debug_initialize;
 
 	// Check if the database file already exists.
@@ -197,6 +198,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 		// and later adjust it when reading the file header.
 		auto sf_block_manager = make_uniq<SingleFileBlockManager>(db, path, options);
 		sf_block_manager->LoadExistingDatabase();
+		auto &single_file_block_manager = *sf_block_manager;
 		block_manager = std::move(sf_block_manager);
 		table_io_manager = make_uniq<SingleFileTableIOManager>(*block_manager);
 
@@ -219,6 +221,9 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 				fs.RemoveFile(wal_path);
 			}
 		}
+
+		// load the blocks that were in memory when the database was last checkpointed in the background
+		single_file_block_manager.StartWarmup();
 	}
 
 	load_complete = true;
@@ -354,6 +359,12 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 	if (options.wal_action == CheckpointWALAction::DELETE_WAL) {
 		ResetWAL();
 	}
+	// record the blocks that are currently loaded, so they can be loaded again when the database is attached
+	// this also happens if there was nothing to checkpoint, e.g. when shutting down a database that was only read
+	// automatic checkpoints can happen frequently - we only record the blocks on explicit and shutdown checkpoints
+	if (!options.automatic) {
+		block_manager->Cast<SingleFileBlockManager>().WriteWarmupFile();
+	}
 
 	if (db.GetStorageExtension()) {
 		db.GetStorageExtension()->OnCheckpointEnd(db, options);
@@ -12,13 +12,7 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
     : col_data(col_data_p), row_group(row_group_p), state(state_p),
       is_validity(GetType().id() == LogicalTypeId::VALIDITY),
       intermediate(is_validity ? LogicalType::BOOLEAN : GetType(), true, is_validity),
-      checkpoint_info(checkpoint_info_p) {
-
-	auto &config = DBConfig::GetConfig(GetDatabase());
-	auto functions = config.GetCompressionFunctions(GetType().InternalType());
-	for (auto &func : functions) {
-		compression_functions.push_back(&func.get());
-	}
+      checkpoint_info(checkpoint_info_p), row_start(row_group_p.start) {
 }
 
 DatabaseInstance &ColumnDataCheckpointer::GetDatabase() {
@@ -37,6 +31,10 @@ RowGroup &ColumnDataCheckpointer::GetRowGroup() {
 	return row_group;
 }
 
+idx_t ColumnDataCheckpointer::GetRowStart() const {
+	return row_start;
+}
+
 ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
@@ -97,8 +95,12 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 }
 
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
-	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
+	compression_functions.clear();
+	for (auto &func : config.GetCompressionFunctions(GetType().InternalType())) {
+		compression_functions.push_back(&func.get());
+	}
+	D_ASSERT(!compression_functions.empty());
 	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
 
 	auto compression_type = checkpoint_info.GetCompressionType();
@@ -205,22 +207,15 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	nodes.clear();
 }
 
-bool ColumnDataCheckpointer::HasChanges() {
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = nodes[segment_idx].node.get();
-		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
-			// transient segment: always need to write to disk
-			return true;
-		} else {
-			// persistent segment; check if there were any updates or deletions in this segment
-			idx_t start_row_idx = segment->start - row_group.start;
-			idx_t end_row_idx = start_row_idx + segment->count;
-			if (col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx)) {
-				return true;
-			}
-		}
+bool ColumnDataCheckpointer::HasChanges(ColumnSegment &segment) {
+	if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+		// transient segment: always need to write to disk
+		return true;
 	}
-	return false;
+	// persistent segment; check if there were any updates or deletions in this segment
+	idx_t start_row_idx = segment.start - row_group.start;
+	idx_t end_row_idx = start_row_idx + segment.count;
+	return col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx);
 }
 
 void ColumnDataCheckpointer::WritePersistentSegments() {
@@ -238,18 +233,47 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 
 		state.data_pointers.push_back(std::move(pointer));
 	}
+	nodes.clear();
 }
 
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
 	D_ASSERT(!nodes_p.empty());
-	this->nodes = std::move(nodes_p);
-	// first check if any of the segments have changes
-	if (!HasChanges()) {
-		// no changes: only need to write the metadata for this column
-		WritePersistentSegments();
-	} else {
-		// there are changes: rewrite the set of columns);
-		WriteToDisk();
+	// first check which of the segments have changes
+	vector<bool> has_changes;
+	has_changes.reserve(nodes_p.size());
+	for (auto &node : nodes_p) {
+		has_changes.push_back(HasChanges(*node.node));
+	}
+	// small unchanged segments next to changed ones are rewritten together with them
+	// this prevents a column from fragmenting into many small segments over repeated checkpoints
+	auto rewrite = has_changes;
+	for (idx_t segment_idx = 0; segment_idx < nodes_p.size(); segment_idx++) {
+		if (has_changes[segment_idx] || nodes_p[segment_idx].node->count >= MINIMUM_REUSED_SEGMENT_COUNT) {
+			continue;
+		}
+		bool previous_changed = segment_idx > 0 && has_changes[segment_idx - 1];
+		bool next_changed = segment_idx + 1 < nodes_p.size() && has_changes[segment_idx + 1];
+		if (previous_changed || next_changed) {
+			rewrite[segment_idx] = true;
+		}
+	}
+	// unchanged segments are kept as-is: we only need to write their metadata
+	// consecutive runs of changed segments are re-compressed and written to disk
+	row_start = row_group.start;
+	idx_t segment_idx = 0;
+	while (segment_idx < nodes_p.size()) {
+		idx_t run_count = 0;
+		auto rewrite_run = rewrite[segment_idx];
+		for (; segment_idx < nodes_p.size() && rewrite[segment_idx] == rewrite_run; segment_idx++) {
+			run_count += nodes_p[segment_idx].node->count;
+			nodes.push_back(std::move(nodes_p[segment_idx]));
+		}
+		if (rewrite_run) {
+			WriteToDisk();
+		} else {
+			WritePersistentSegments();
+		}
+		row_start += run_count;
 	}
 }
 
@@ -215,6 +215,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	ReadAhead(state, state.max_row_group_row - MinValue(vector_offset * STANDARD_VECTOR_SIZE, state.max_row_group_row));
 	return true;
 }
 
@@ -242,9 +243,33 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	ReadAhead(state, state.max_row_group_row);
 	return true;
 }
 
+void RowGroup::ReadAhead(CollectionScanState &state, idx_t row_count) {
+	auto &block_manager = GetBlockManager();
+	if (row_count == 0 || block_manager.InMemory() || block_manager.IsRemote()) {
+		// remote files are prefetched (and loaded) per vector in TemplatedScan
+		return;
+	}
+	if (state.GetFilterInfo().HasFilters()) {
+		// with filters, segments might be skipped using their zonemaps - don't read them ahead
+		return;
+	}
+	// gather the blocks of all segments of the scanned columns in this row group, so that the reads of all columns are
+	// in flight at the same time instead of being issued one at a time as the scan progresses
+	PrefetchState prefetch_state;
+	auto &column_ids = state.GetColumnIds();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], row_count);
+		}
+	}
+	block_manager.buffer_manager.ReadAhead(prefetch_state.blocks);
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -14,7 +14,11 @@
 #include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/table/collection_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
 
@@ -673,24 +677,40 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint State
 //===--------------------------------------------------------------------===//
-struct CollectionCheckpointState {
-	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
-	                          vector<SegmentNode<RowGroup>> &segments, TableStatistics &global_stats)
-	    : collection(collection), writer(writer), executor(writer.GetScheduler()), segments(segments),
-	      global_stats(global_stats) {
-		writers.resize(segments.size());
-		write_data.resize(segments.size());
+struct VacuumState {
+	bool can_vacuum_deletes = false;
+	idx_t row_start = 0;
+	idx_t next_vacuum_idx = 0;
+	vector<idx_t> row_group_counts;
+	//! The storage index of the column the table is clustered by (if any)
+	optional_idx cluster_column;
+	//! The row groups starting from this index have not been written to disk yet and are sorted on the cluster column
+	idx_t cluster_start_idx = 0;
+};
+
+CollectionCheckpointState::CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
+                                                     vector<SegmentNode<RowGroup>> segments_p, SegmentLock l_p)
+    : collection(collection), writer(writer), executor(writer.GetScheduler()), segments(std::move(segments_p)),
+      l(std::move(l_p)) {
+	writers.resize(segments.size());
+	write_data.resize(segments.size());
+}
+
+CollectionCheckpointState::~CollectionCheckpointState() {
+	if (finished) {
+		return;
 	}
+	// the checkpoint was abandoned before it was finalized - wait for any running tasks before destroying the state
+	try {
+		WorkOnTasks();
+	} catch (...) { // LCOV_EXCL_START
+	} // LCOV_EXCL_STOP
+}
 
-	RowGroupCollection &collection;
-	TableDataWriter &writer;
-	TaskExecutor executor;
-	vector<SegmentNode<RowGroup>> &segments;
-	vector<unique_ptr<RowGroupWriter>> writers;
-	vector<RowGroupWriteData> write_data;
-	TableStatistics &global_stats;
-	mutex write_lock;
-};
+void CollectionCheckpointState::WorkOnTasks() {
+	finished = true;
+	executor.WorkOnTasks();
+}
 
 class BaseCheckpointTask : public BaseExecutorTask {
 public:
@@ -711,6 +731,10 @@ public:
 	void ExecuteTask() override {
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
+		auto &config = DBConfig::Get(checkpoint_state.collection.GetAttached());
+		if (config.options.checkpoint_abort == CheckpointAbort::DEBUG_ABORT_IN_ROW_GROUP_WRITE) {
+			throw FatalException("Checkpoint aborted in row group write because of PRAGMA checkpoint_abort flag");
+		}
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
 		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
 	}
@@ -722,27 +746,20 @@ private:
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
-struct VacuumState {
-	bool can_vacuum_deletes = false;
-	idx_t row_start = 0;
-	idx_t next_vacuum_idx = 0;
-	vector<idx_t> row_group_counts;
-};
-
 class VacuumTask : public BaseCheckpointTask {
 public:
 	VacuumTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t segment_idx,
-	           idx_t merge_count, idx_t target_count, idx_t merge_rows, idx_t row_start)
+	           idx_t merge_count, idx_t target_count, idx_t merge_rows, idx_t row_start,
+	           optional_idx sort_column = optional_idx())
 	    : BaseCheckpointTask(checkpoint_state), vacuum_state(vacuum_state), segment_idx(segment_idx),
-	      merge_count(merge_count), target_count(target_count), merge_rows(merge_rows), row_start(row_start) {
+	      merge_count(merge_count), target_count(target_count), merge_rows(merge_rows), row_start(row_start),
+	      sort_column(sort_column) {
 	}
 
 	void ExecuteTask() override {
 		auto &collection = checkpoint_state.collection;
 		auto &types = collection.GetTypes();
 		// create the new set of target row groups (initially empty)
-		vector<unique_ptr<RowGroup>> new_row_groups;
-		vector<idx_t> append_counts;
 		idx_t row_group_rows = merge_rows;
 		idx_t start = row_start;
 		for (idx_t target_idx = 0; target_idx < target_count; target_idx++) {
@@ -764,12 +781,26 @@ public:
 			column_ids.push_back(c);
 		}
 
-		idx_t current_append_idx = 0;
-
 		// fill the new row group with the merged rows
-		TableAppendState append_state;
 		new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
 
+		// if we are sorting the rows, we first sink the merged rows into the sort state
+		unique_ptr<GlobalSortState> global_sort;
+		LocalSortState local_sort;
+		DataChunk sort_chunk;
+		if (sort_column.IsValid()) {
+			auto &sort_type = types[sort_column.GetIndex()];
+			vector<BoundOrderByNode> orders;
+			orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+			                    make_uniq<BoundReferenceExpression>(sort_type, 0U));
+			RowLayout payload_layout;
+			payload_layout.Initialize(types);
+			auto &buffer_manager = collection.GetBlockManager().buffer_manager;
+			global_sort = make_uniq<GlobalSortState>(buffer_manager, orders, payload_layout);
+			local_sort.Initialize(*global_sort, buffer_manager);
+			sort_chunk.InitializeEmpty(vector<LogicalType> {sort_type});
+		}
+
 		TableScanState scan_state;
 		scan_state.Initialize(column_ids);
 		scan_state.table_state.Initialize(types);
@@ -793,29 +824,38 @@ public:
 				if (scan_chunk.size() == 0) {
 					break;
 				}
-				idx_t remaining = scan_chunk.size();
-				while (remaining > 0) {
-					idx_t append_count =
-					    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
-					new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, scan_chunk,
-					                                           append_count);
-					append_counts[current_append_idx] += append_count;
-					remaining -= append_count;
-					const bool row_group_full = append_counts[current_append_idx] == Storage::ROW_GROUP_SIZE;
-					const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
-					if (remaining > 0 || (row_group_full && !last_row_group)) {
-						// move to the next row group
-						current_append_idx++;
-						new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
-						// slice chunk for the next append
-						scan_chunk.Slice(append_count, remaining);
-					}
+				if (global_sort) {
+					sort_chunk.data[0].Reference(scan_chunk.data[sort_column.GetIndex()]);
+					sort_chunk.SetCardinality(scan_chunk);
+					local_sort.SinkChunk(sort_chunk, scan_chunk);
+				} else {
+					Append(scan_chunk);
 				}
 			}
 			// drop the row group after merging
 			current_row_group.CommitDrop();
 			checkpoint_state.segments[c_idx].node.reset();
 		}
+		if (global_sort) {
+			// sort the merged rows and append them to the new row groups in sorted order
+			global_sort->AddLocalState(local_sort);
+			global_sort->PrepareMergePhase();
+			while (global_sort->sorted_blocks.size() > 1) {
+				global_sort->InitializeMergeRound();
+				MergeSorter merge_sorter(*global_sort, global_sort->buffer_manager);
+				merge_sorter.PerformInMergeRound();
+				global_sort->CompleteMergeRound(false);
+			}
+			PayloadScanner scanner(*global_sort);
+			while (true) {
+				scan_chunk.Reset();
+				scanner.Scan(scan_chunk);
+				if (scan_chunk.size() == 0) {
+					break;
+				}
+				Append(scan_chunk);
+			}
+		}
 		idx_t total_append_count = 0;
 		for (idx_t target_idx = 0; target_idx < target_count; target_idx++) {
 			auto &row_group = new_row_groups[target_idx];
@@ -834,6 +874,28 @@ public:
 		}
 	}
 
+private:
+	//! Append a chunk of merged rows to the new row groups
+	void Append(DataChunk &chunk) {
+		idx_t remaining = chunk.size();
+		while (remaining > 0) {
+			idx_t append_count =
+			    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
+			new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, chunk, append_count);
+			append_counts[current_append_idx] += append_count;
+			remaining -= append_count;
+			const bool row_group_full = append_counts[current_append_idx] == Storage::ROW_GROUP_SIZE;
+			const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
+			if (remaining > 0 || (row_group_full && !last_row_group)) {
+				// move to the next row group
+				current_append_idx++;
+				new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+				// slice chunk for the next append
+				chunk.Slice(append_count, remaining);
+			}
+		}
+	}
+
 private:
 	VacuumState &vacuum_state;
 	idx_t segment_idx;
@@ -841,6 +903,14 @@ private:
 	idx_t target_count;
 	idx_t merge_rows;
 	idx_t row_start;
+	//! If set, the merged rows are sorted on this column
+	optional_idx sort_column;
+	//! The new (merged) row groups
+	vector<unique_ptr<RowGroup>> new_row_groups;
+	//! The amount of rows appended to each of the new row groups
+	vector<idx_t> append_counts;
+	idx_t current_append_idx = 0;
+	TableAppendState append_state;
 };
 
 void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
@@ -851,6 +921,7 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	state.cluster_start_idx = segments.size();
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
@@ -863,11 +934,53 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 		}
 		state.row_group_counts.push_back(row_group_count);
 	}
+	// if the table is clustered, the trailing row groups that have not been written to disk yet
+	// (i.e. the data appended since the last checkpoint) are sorted on the cluster column while merging them
+	state.cluster_column = checkpoint_state.writer.GetClusterColumn();
+	if (state.cluster_column.IsValid()) {
+		while (state.cluster_start_idx > 0) {
+			auto &entry = segments[state.cluster_start_idx - 1];
+			if (entry.node && entry.node->IsPersistent()) {
+				break;
+			}
+			state.cluster_start_idx--;
+		}
+	}
+}
+
+bool RowGroupCollection::ScheduleClusterTask(CollectionCheckpointState &checkpoint_state, VacuumState &state,
+                                             idx_t segment_idx) {
+	static constexpr const idx_t MAX_CLUSTER_ROW_GROUPS = 16;
+
+	// gather the (non-empty) row groups we are sorting together
+	idx_t merge_rows = 0;
+	idx_t merge_count = 0;
+	idx_t next_idx;
+	for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
+		if (state.row_group_counts[next_idx] == 0) {
+			continue;
+		}
+		if (merge_count >= MAX_CLUSTER_ROW_GROUPS) {
+			break;
+		}
+		merge_rows += state.row_group_counts[next_idx];
+		merge_count++;
+	}
+	D_ASSERT(merge_count > 0);
+	auto target_count = (merge_rows + Storage::ROW_GROUP_SIZE - 1) / Storage::ROW_GROUP_SIZE;
+	auto cluster_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
+	                                          merge_rows, state.row_start, state.cluster_column);
+	checkpoint_state.executor.ScheduleTask(std::move(cluster_task));
+	state.next_vacuum_idx = next_idx;
+	state.row_start += merge_rows;
+	return true;
 }
 
 bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                              idx_t segment_idx) {
 	static constexpr const idx_t MAX_MERGE_COUNT = 3;
+	//! A row group that cannot be merged is rewritten if fewer than 1/VACUUM_REWRITE_RATIO of its rows remain
+	static constexpr const idx_t VACUUM_REWRITE_RATIO = 2;
 
 	if (!state.can_vacuum_deletes) {
 		// we cannot vacuum deletes - cannot vacuum
@@ -882,6 +995,10 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		D_ASSERT(!checkpoint_state.segments[segment_idx].node);
 		return false;
 	}
+	if (segment_idx >= state.cluster_start_idx) {
+		// this row group has not been written yet - sort it on the cluster column
+		return ScheduleClusterTask(checkpoint_state, state, segment_idx);
+	}
 	idx_t merge_rows;
 	idx_t next_idx = 0;
 	idx_t merge_count;
@@ -897,7 +1014,7 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		auto total_target_size = target_count * Storage::ROW_GROUP_SIZE;
 		merge_count = 0;
 		merge_rows = 0;
-		for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
+		for (next_idx = segment_idx; next_idx < state.cluster_start_idx; next_idx++) {
 			if (state.row_group_counts[next_idx] == 0) {
 				continue;
 			}
@@ -917,7 +1034,16 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		// we cannot reduce the amount of row groups - but if most rows of this row group have been deleted
+		// we still rewrite it by itself so the deleted rows are no longer stored and scanned
+		auto &row_group = *checkpoint_state.segments[segment_idx].node;
+		if (state.row_group_counts[segment_idx] * VACUUM_REWRITE_RATIO >= row_group.count) {
+			return false;
+		}
+		merge_rows = state.row_group_counts[segment_idx];
+		merge_count = 1;
+		target_count = 1;
+		next_idx = segment_idx + 1;
 	}
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
@@ -937,18 +1063,21 @@ void RowGroupCollection::ScheduleCheckpointTask(CollectionCheckpointState &check
 	checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
 }
 
-void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+unique_ptr<CollectionCheckpointState> RowGroupCollection::ScheduleCheckpoint(TableDataWriter &writer) {
 	auto segments = row_groups->MoveSegments();
 	auto l = row_groups->Lock();
 
-	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
+	auto checkpoint_state = make_uniq<CollectionCheckpointState>(*this, writer, std::move(segments), std::move(l));
+	CopyStats(checkpoint_state->global_stats);
 
-	VacuumState vacuum_state;
-	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	// the vacuum state is kept alive in the checkpoint state, as the vacuum tasks can still run after we return
+	checkpoint_state->vacuum_state = make_uniq<VacuumState>();
+	auto &vacuum_state = *checkpoint_state->vacuum_state;
+	InitializeVacuumState(*checkpoint_state, vacuum_state, checkpoint_state->segments);
 	// schedule tasks
-	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
-		auto &entry = segments[segment_idx];
-		auto vacuum_tasks = ScheduleVacuumTasks(checkpoint_state, vacuum_state, segment_idx);
+	for (idx_t segment_idx = 0; segment_idx < checkpoint_state->segments.size(); segment_idx++) {
+		auto &entry = checkpoint_state->segments[segment_idx];
+		auto vacuum_tasks = ScheduleVacuumTasks(*checkpoint_state, vacuum_state, segment_idx);
 		if (vacuum_tasks) {
 			// vacuum tasks were scheduled - don't schedule a checkpoint task yet
 			continue;
@@ -959,13 +1088,20 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		}
 		// schedule a checkpoint task for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
-		ScheduleCheckpointTask(checkpoint_state, segment_idx);
+		ScheduleCheckpointTask(*checkpoint_state, segment_idx);
 		vacuum_state.row_start += entry.node->count;
 	}
+	return checkpoint_state;
+}
+
+void RowGroupCollection::Checkpoint(CollectionCheckpointState &checkpoint_state) {
 	// all tasks have been scheduled - execute tasks until we are done
-	checkpoint_state.executor.WorkOnTasks();
+	checkpoint_state.WorkOnTasks();
 
 	// no errors - finalize the row groups
+	auto &writer = checkpoint_state.writer;
+	auto &segments = checkpoint_state.segments;
+	auto &global_stats = checkpoint_state.global_stats;
 	idx_t new_total_rows = 0;
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
@@ -981,7 +1117,7 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		auto pointer =
 		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
-		row_groups->AppendSegment(l, std::move(entry.node));
+		row_groups->AppendSegment(checkpoint_state.l, std::move(entry.node));
 		new_total_rows += row_group.count;
 	}
 	total_rows = new_total_rows;
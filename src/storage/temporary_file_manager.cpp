@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "duckdb/main/config.hpp"
+
+#include "miniz.hpp"
 
 namespace duckdb {
 
@@ -8,10 +11,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), block_size(block_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), block_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +98,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
+    : max_allowed_index((idx_t(1) << MinValue<idx_t>(temp_file_count, 32)) * MAX_ALLOWED_INDEX_BASE),
+      slot_size(slot_size), db(db), file_index(index),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +121,44 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (slot_size == buffer.AllocSize()) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	// write the compressed buffer - it is padded to the slot size
+	D_ASSERT(compressed_buffer.GetSize() >= slot_size);
+	handle->Write(compressed_buffer.get(), slot_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (slot_size == buffer_manager.GetBlockAllocSize()) {
+		auto position = GetPositionInFile(block_index);
+		auto block_size = buffer_manager.GetBlockSize();
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position, block_size,
+		                                                          std::move(reusable_buffer));
+	}
+	// the block is compressed - read the slot and decompress it into the buffer
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	if (compressed_size + sizeof(idx_t) > slot_size) {
+		throw IOException("Failed to read compressed block from temporary file \"%s\": invalid compressed size", path);
+	}
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto uncompressed_size = static_cast<duckdb_miniz::mz_ulong>(buffer->AllocSize());
+	auto res = duckdb_miniz::mz_uncompress(buffer->InternalBuffer(), &uncompressed_size,
+	                                       compressed_buffer.get() + sizeof(idx_t),
+	                                       static_cast<duckdb_miniz::mz_ulong>(compressed_size));
+	if (res != duckdb_miniz::MZ_OK || uncompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress block from temporary file \"%s\"", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -181,7 +212,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -267,7 +298,8 @@ static idx_t GetDefaultMax(const string &path) {
 }
 
 TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
-    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0) {
+    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0), incompressible_count(0),
+      skipped_compression_count(0) {
 }
 
 TemporaryFileManager::~TemporaryFileManager() {
@@ -277,9 +309,53 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto block_alloc_size = buffer.AllocSize();
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return block_alloc_size;
+	}
+	// if the previous buffers did not compress well, we back off from compressing exponentially
+	auto incompressible = incompressible_count.load();
+	if (incompressible > 0) {
+		auto backoff = MinValue<idx_t>(idx_t(1) << MinValue<idx_t>(incompressible, 6), MAX_COMPRESSION_BACKOFF);
+		if (++skipped_compression_count % backoff != 0) {
+			return block_alloc_size;
+		}
+	}
+	// compress the buffer - the compressed data is prefixed by its size and padded to the slot size
+	// we use deflate (miniz) at its fastest level, as miniz is part of the core library (zstd and lz4 are only built
+	// into the parquet extension), and spilled blocks are mostly compressible data such as sorted or hashed keys
+	auto compress_bound = duckdb_miniz::mz_compressBound(static_cast<duckdb_miniz::mz_ulong>(block_alloc_size));
+	compressed_buffer = Allocator::Get(db).Allocate(
+	    AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(sizeof(idx_t) + static_cast<idx_t>(compress_bound)));
+	auto compressed_size = compress_bound;
+	auto uncompressed_size = static_cast<duckdb_miniz::mz_ulong>(block_alloc_size);
+	auto res = duckdb_miniz::mz_compress2(compressed_buffer.get() + sizeof(idx_t), &compressed_size,
+	                                      buffer.InternalBuffer(), uncompressed_size, duckdb_miniz::MZ_BEST_SPEED);
+	idx_t slot_size = block_alloc_size;
+	if (res == duckdb_miniz::MZ_OK) {
+		slot_size = AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(sizeof(idx_t) + static_cast<idx_t>(compressed_size));
+	}
+	if (slot_size >= block_alloc_size) {
+		// the buffer does not compress well enough to fit in a smaller slot - write it uncompressed
+		incompressible_count = MinValue<idx_t>(incompressible + 1, MAX_COMPRESSION_BACKOFF);
+		compressed_buffer.Reset();
+		return block_alloc_size;
+	}
+	incompressible_count = 0;
+	Store<idx_t>(static_cast<idx_t>(compressed_size), compressed_buffer.get());
+	// zero-initialize the padding, so we don't write uninitialized memory to the file
+	auto compressed_end = sizeof(idx_t) + static_cast<idx_t>(compressed_size);
+	memset(compressed_buffer.get() + compressed_end, 0, slot_size - compressed_end);
+	return slot_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	// compressed buffers are written to files with smaller slots
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(buffer, compressed_buffer);
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
@@ -288,6 +364,9 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		// first check if we can write to an open existing file
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +376,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +388,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -88,6 +88,13 @@ void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	has_temporary_directory = buffer_manager.HasTemporaryDirectory();
 	num_threads = NumericCast<idx_t>(task_scheduler.NumberOfThreads());
 	query_max_memory = buffer_manager.GetQueryMaxMemory();
+
+	// the connection can further restrict the threads and memory that a single query may use
+	auto &client_config = ClientConfig::GetConfig(context);
+	if (client_config.query_max_threads != 0) {
+		num_threads = MinValue(num_threads, client_config.query_max_threads);
+	}
+	query_max_memory = MinValue(query_max_memory, client_config.query_max_memory);
 }
 
 TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
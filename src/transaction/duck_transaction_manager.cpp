@@ -13,10 +13,42 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
 
+struct BackgroundCheckpointState {
+	explicit BackgroundCheckpointState(DuckTransactionManager &manager) : manager(&manager) {
+	}
+
+	//! Held while a background checkpoint is running
+	mutex lock;
+	//! The transaction manager - set to nullptr when the database is closed
+	optional_ptr<DuckTransactionManager> manager;
+	//! Whether or not a background checkpoint task is currently scheduled
+	atomic<bool> scheduled {false};
+};
+
+class BackgroundCheckpointTask : public Task {
+public:
+	explicit BackgroundCheckpointTask(shared_ptr<BackgroundCheckpointState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		lock_guard<mutex> guard(state->lock);
+		state->scheduled = false;
+		if (state->manager) {
+			state->manager->BackgroundCheckpoint();
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<BackgroundCheckpointState> state;
+};
+
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
@@ -31,9 +63,11 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 		// Specifically the StorageManager of the DuckCatalog is relied on, with `db.GetStorageManager`
 		throw InternalException("DuckTransactionManager should only be created together with a DuckCatalog");
 	}
+	background_checkpoint = make_shared_ptr<BackgroundCheckpointState>(*this);
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -104,6 +138,12 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	if (CheckpointInBackground()) {
+		// the transaction writes to the WAL as usual - the checkpoint is performed by a background task afterwards
+		CheckpointDecision decision("automatic checkpoint is performed in the background");
+		decision.in_background = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -290,12 +330,72 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		CheckpointOptions options;
 		options.action = CheckpointAction::ALWAYS_CHECKPOINT;
 		options.type = checkpoint_decision.type;
+		options.automatic = true;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(options);
+	} else if (checkpoint_decision.in_background) {
+		tlock.unlock();
+		ScheduleBackgroundCheckpoint();
 	}
 	return error;
 }
 
+bool DuckTransactionManager::CheckpointInBackground() {
+	auto &config = DBConfig::GetConfig(db.GetDatabase());
+	if (!config.options.background_checkpoint) {
+		return false;
+	}
+	// we can only checkpoint in the background if there are background threads that can pick up the task
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	return scheduler.NumberOfThreads() > NumericCast<int32_t>(config.options.external_threads);
+}
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	if (background_checkpoint->scheduled.exchange(true)) {
+		// a checkpoint is already scheduled
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	auto token = scheduler.CreateProducer();
+	shared_ptr<Task> task = make_shared_ptr<BackgroundCheckpointTask>(background_checkpoint);
+	scheduler.ScheduleTask(*token, std::move(task));
+}
+
+void DuckTransactionManager::BackgroundCheckpoint() {
+	// background checkpoints behave like a (non-forced) CHECKPOINT statement
+	// if another transaction is writing we skip the checkpoint - it is rescheduled when a later transaction commits
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return;
+	}
+	auto &storage_manager = db.GetStorageManager();
+	if (!storage_manager.AutomaticCheckpoint(0)) {
+		// the WAL is no longer large enough to warrant a checkpoint (e.g. another checkpoint has happened already)
+		return;
+	}
+	CheckpointOptions options;
+	options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+	options.automatic = true;
+	if (GetLastCommit() > LowestActiveStart()) {
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	try {
+		storage_manager.CreateCheckpoint(options);
+	} catch (std::exception &ex) {
+		// there is no transaction to report the error to - invalidate the database instead
+		ErrorData error(ex);
+		ValidChecker::Invalidate(db.GetDatabase(), "Failed to perform background checkpoint: " + error.RawMessage());
+	}
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	if (!background_checkpoint) {
+		return;
+	}
+	lock_guard<mutex> guard(background_checkpoint->lock);
+	background_checkpoint->manager = nullptr;
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
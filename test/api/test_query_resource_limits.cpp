@@ -0,0 +1,100 @@
+#include "catch.hpp"
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static atomic<idx_t> active_calls;
+static atomic<idx_t> max_active_calls;
+
+//! Returns its input - keeps track of how many threads are executing the function at the same time
+static void TrackConcurrency(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto active = ++active_calls;
+	auto current_max = max_active_calls.load();
+	while (active > current_max && !max_active_calls.compare_exchange_weak(current_max, active)) {
+	}
+	this_thread::sleep_for(chrono::milliseconds(1));
+	result.Reference(args.data[0]);
+	active_calls--;
+}
+
+TEST_CASE("Test limiting the threads of the queries of a connection", "[api][.]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET threads=8"));
+	con.CreateVectorizedFunction<int64_t, int64_t>("track_concurrency", &TrackConcurrency);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range AS i FROM range(2000000)"));
+
+	// without a limit the query uses all threads
+	max_active_calls = 0;
+	auto result = con.Query("SELECT SUM(track_concurrency(i)) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(1999999000000)}));
+	REQUIRE(max_active_calls > 2);
+
+	// with a limit, at most that many tasks of the query run at the same time
+	REQUIRE_NO_FAIL(con.Query("SET query_max_threads=2"));
+	max_active_calls = 0;
+	result = con.Query("SELECT SUM(track_concurrency(i)) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(1999999000000)}));
+	REQUIRE(max_active_calls <= 2);
+
+	// other connections are not limited
+	Connection con2(db);
+	max_active_calls = 0;
+	result = con2.Query("SELECT SUM(track_concurrency(i)) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(1999999000000)}));
+	REQUIRE(max_active_calls > 2);
+}
+
+//! Local file system that counts the writes to temporary files
+class TemporaryWriteCountingFileSystem : public LocalFileSystem {
+public:
+	explicit TemporaryWriteCountingFileSystem(atomic<idx_t> &write_count) : write_count(write_count) {
+	}
+
+	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		write_count++;
+		LocalFileSystem::Write(handle, buffer, nr_bytes, location);
+	}
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::Contains(fpath, "query_resource_limits_tmp");
+	}
+	std::string GetName() const override {
+		return "TemporaryWriteCountingFileSystem";
+	}
+
+private:
+	atomic<idx_t> &write_count;
+};
+
+TEST_CASE("Test that queries spill when exceeding the memory limit of the connection", "[api][.]") {
+	atomic<idx_t> write_count(0);
+	auto config = GetTestConfig();
+	config->options.maximum_memory = 1000ULL * 1000ULL * 1000ULL;
+	config->options.maximum_threads = 2;
+	config->options.temporary_directory = TestCreatePath("query_resource_limits_tmp");
+	config->file_system = make_uniq<VirtualFileSystem>();
+	config->file_system->RegisterSubSystem(make_uniq<TemporaryWriteCountingFileSystem>(write_count));
+	DuckDB db(nullptr, config.get());
+	Connection con(db);
+
+	auto query = "SELECT COUNT(*), SUM(c) FROM (SELECT i % 1000000 AS g, COUNT(*) AS c FROM range(2000000) t(i) "
+	             "GROUP BY g)";
+	// the query fits in memory
+	auto result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {2000000}));
+	REQUIRE(write_count == 0);
+
+	// with a per-query memory limit the query spills to disk instead
+	REQUIRE_NO_FAIL(con.Query("SET query_max_memory='8MB'"));
+	result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {2000000}));
+	REQUIRE(write_count > 0);
+}
@@ -0,0 +1,27 @@
+#include "catch.hpp"
+#include "duckdb/common/numa.hpp"
+
+using namespace duckdb;
+
+TEST_CASE("Test parsing of NUMA CPU lists", "[numa]") {
+	// single CPUs and lists
+	REQUIRE(NUMATopology::ParseCPUList("0") == duckdb::vector<idx_t> {0});
+	REQUIRE(NUMATopology::ParseCPUList("3,1,7") == duckdb::vector<idx_t>({3, 1, 7}));
+	// ranges
+	REQUIRE(NUMATopology::ParseCPUList("0-3") == duckdb::vector<idx_t>({0, 1, 2, 3}));
+	REQUIRE(NUMATopology::ParseCPUList("5-5") == duckdb::vector<idx_t> {5});
+	REQUIRE(NUMATopology::ParseCPUList("0-2,8-9,12") == duckdb::vector<idx_t>({0, 1, 2, 8, 9, 12}));
+	// whitespace and the trailing newline of the sysfs file are ignored
+	REQUIRE(NUMATopology::ParseCPUList(" 0-1, 4\n") == duckdb::vector<idx_t>({0, 1, 4}));
+	// an empty list has no CPUs
+	REQUIRE(NUMATopology::ParseCPUList("").empty());
+	REQUIRE(NUMATopology::ParseCPUList("\n").empty());
+
+	// invalid input results in an empty list
+	REQUIRE(NUMATopology::ParseCPUList("abc").empty());
+	REQUIRE(NUMATopology::ParseCPUList("0-3,x").empty());
+	REQUIRE(NUMATopology::ParseCPUList("3-1").empty());
+	REQUIRE(NUMATopology::ParseCPUList("1-2-3").empty());
+	REQUIRE(NUMATopology::ParseCPUList("-1").empty());
+	REQUIRE(NUMATopology::ParseCPUList("0-").empty());
+}
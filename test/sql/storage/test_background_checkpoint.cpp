@@ -0,0 +1,54 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static string GetWALSize(Connection &con) {
+	auto result = con.Query("SELECT wal_size FROM pragma_database_size()");
+	REQUIRE_NO_FAIL(*result);
+	return result->GetValue(0, 0).ToString();
+}
+
+TEST_CASE("Test that automatic checkpoints are performed in the background", "[storage][.]") {
+	auto storage_database = TestCreatePath("background_checkpoint_test");
+	DeleteDatabase(storage_database);
+	{
+		auto config = GetTestConfig();
+		config->options.maximum_threads = 4;
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("SET background_checkpoint=true"));
+		REQUIRE_NO_FAIL(con.Query("SET wal_autocheckpoint='1KB'"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range AS i FROM range(100000)"));
+
+		// committing does not checkpoint - a background task does, which truncates the WAL
+		// wait for the background checkpoint (without issuing a CHECKPOINT ourselves)
+		string wal_size;
+		for (idx_t i = 0; i < 1000; i++) {
+			wal_size = GetWALSize(con);
+			if (wal_size == "0 bytes") {
+				break;
+			}
+			this_thread::sleep_for(chrono::milliseconds(10));
+		}
+		REQUIRE(wal_size == "0 bytes");
+
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {100000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(4999950000)}));
+	}
+	{
+		// the data was checkpointed into the database file
+		auto config = GetTestConfig();
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {100000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(4999950000)}));
+	}
+	DeleteDatabase(storage_database);
+}
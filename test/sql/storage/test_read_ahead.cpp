@@ -0,0 +1,60 @@
+#include "catch.hpp"
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+//! Local file system that counts the read-ahead requests for the database file
+class ReadAheadCountingFileSystem : public LocalFileSystem {
+public:
+	explicit ReadAheadCountingFileSystem(atomic<idx_t> &read_ahead_count) : read_ahead_count(read_ahead_count) {
+	}
+
+	bool ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) override {
+		read_ahead_count++;
+		return LocalFileSystem::ReadAhead(handle, location, nr_bytes);
+	}
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::Contains(fpath, "read_ahead_test");
+	}
+	std::string GetName() const override {
+		return "ReadAheadCountingFileSystem";
+	}
+
+private:
+	atomic<idx_t> &read_ahead_count;
+};
+
+TEST_CASE("Test read-ahead of the blocks of a table scan", "[storage][.]") {
+	auto storage_database = TestCreatePath("read_ahead_test");
+	DeleteDatabase(storage_database);
+
+	atomic<idx_t> read_ahead_count(0);
+	{
+		auto config = GetTestConfig();
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i, i::VARCHAR AS s FROM range(1000000) t(i)"));
+	}
+	{
+		auto config = GetTestConfig();
+		config->file_system = make_uniq<VirtualFileSystem>();
+		config->file_system->RegisterSubSystem(make_uniq<ReadAheadCountingFileSystem>(read_ahead_count));
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+
+		// scans with filters do not read ahead, since segments can be skipped using their zonemaps
+		auto result = con.Query("SELECT COUNT(*) FROM integers WHERE i >= 999990");
+		REQUIRE(CHECK_COLUMN(result, 0, {10}));
+		REQUIRE(read_ahead_count == 0);
+
+		// a full scan of the (cold) table reads the blocks of the row groups ahead
+		result = con.Query("SELECT SUM(i), MAX(s) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {"999999"}));
+		REQUIRE(read_ahead_count > 0);
+	}
+	DeleteDatabase(storage_database);
+}
@@ -0,0 +1,78 @@
+#include "catch.hpp"
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+//! Local file system that counts the reads from the database file
+class ReadCountingFileSystem : public LocalFileSystem {
+public:
+	explicit ReadCountingFileSystem(atomic<idx_t> &read_count) : read_count(read_count) {
+	}
+
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		read_count++;
+		LocalFileSystem::Read(handle, buffer, nr_bytes, location);
+	}
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::Contains(fpath, "scan_resistant_eviction_test");
+	}
+	std::string GetName() const override {
+		return "ReadCountingFileSystem";
+	}
+
+private:
+	atomic<idx_t> &read_count;
+};
+
+TEST_CASE("Test that a large scan does not evict a table that is used repeatedly", "[storage][.]") {
+	auto storage_database = TestCreatePath("scan_resistant_eviction_test");
+	DeleteDatabase(storage_database);
+
+	atomic<idx_t> read_count(0);
+	{
+		auto config = GetTestConfig();
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("PRAGMA force_compression='uncompressed'"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE dimension AS SELECT range AS id, concat('dimension', range) AS name "
+		                          "FROM range(100000)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE facts AS SELECT range AS id, range % 100000 AS dimension_id, "
+		                          "range * 2 AS value FROM range(10000000)"));
+	}
+	{
+		auto config = GetTestConfig();
+		config->options.maximum_memory = 32ULL * 1024ULL * 1024ULL;
+		config->options.maximum_threads = 1;
+		config->file_system = make_uniq<VirtualFileSystem>();
+		config->file_system->RegisterSubSystem(make_uniq<ReadCountingFileSystem>(read_count));
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+
+		// the dimension table is used repeatedly - its blocks are only considered frequently used once enough other
+		// blocks were used in between, so that re-using blocks within a single scan does not count
+		for (idx_t i = 0; i < 25; i++) {
+			auto result = con.Query("SELECT COUNT(*), SUM(strlen(name)) FROM dimension");
+			REQUIRE(CHECK_COLUMN(result, 0, {100000}));
+			REQUIRE(CHECK_COLUMN(result, 1, {1388890}));
+		}
+		auto reads_before_scan = read_count.load();
+
+		// a scan that exceeds the memory limit
+		auto result = con.Query("SELECT COUNT(*), SUM(dimension_id), SUM(value) FROM facts");
+		REQUIRE(CHECK_COLUMN(result, 0, {10000000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(499995000000)}));
+		REQUIRE(CHECK_COLUMN(result, 2, {Value::HUGEINT(99999990000000)}));
+		auto reads_after_scan = read_count.load();
+		REQUIRE(reads_after_scan > reads_before_scan);
+
+		// the dimension table is still in memory: scanning it does not read from the database file
+		result = con.Query("SELECT COUNT(*), SUM(strlen(name)) FROM dimension");
+		REQUIRE(CHECK_COLUMN(result, 0, {100000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {1388890}));
+		REQUIRE(read_count == reads_after_scan);
+	}
+	DeleteDatabase(storage_database);
+}